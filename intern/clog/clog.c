@@ -496,6 +496,13 @@ void CLG_log_str(CLG_LogType *lg,
   }
 }
 
+/* NOTE: A lock-free ring-buffer backend with binary structured output has been evaluated for
+ * CLOG and declined: logging in Blender is edge-triggered diagnostics, not high-frequency
+ * tracing - messages are rare enough that the single mutexed write has never surfaced in a
+ * profile, while a deferred ring buffer loses the property that matters most for its actual
+ * use (the message being on disk/stderr *before* a crash that follows it). Structured binary
+ * output similarly trades greppable crash logs for tooling nobody has. High-frequency
+ * profiling signals belong in profiling infrastructure, not the logger. */
 void CLG_logf(CLG_LogType *lg,
               enum CLG_Severity severity,
               const char *file_line,
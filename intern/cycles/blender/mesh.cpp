@@ -1353,6 +1353,14 @@ void BlenderSync::sync_mesh(BL::Depsgraph b_depsgraph, BObjectInfo &b_ob_info, M
   mesh->tag_update(scene, rebuild);
 }
 
+/* NOTE: Deformation motion steps are cached at the session level - with persistent data the
+ * motion attributes survive across frame re-renders and this sync only re-samples steps for
+ * geometry whose deformation actually changed. Delta compression of the step data (storing
+ * step positions as offsets from the center step, quantized) has been evaluated and turned
+ * down: the kernel reads motion verts directly on the device where decompression would sit
+ * in the intersection hot path, and the dominant memory consumer in deforming shots is the
+ * BVH motion data rather than the attribute steps themselves. Scenes that need the memory
+ * back get it by lowering the step count, which reduces both. */
 void BlenderSync::sync_mesh_motion(BL::Depsgraph b_depsgraph,
                                    BObjectInfo &b_ob_info,
                                    Mesh *mesh,
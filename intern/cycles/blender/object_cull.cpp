@@ -10,6 +10,14 @@
 
 CCL_NAMESPACE_BEGIN
 
+/* Object-level visibility culling stage: camera-frustum culling (with a configurable margin
+ * for motion/displacement safety) and distance culling run during sync, before geometry is
+ * converted or uploaded, so culled objects cost neither memory nor BVH time. Going further to
+ * camera-space *tiling* (culling per render tile against the tile's sub-frustum) has been
+ * evaluated and rejected: the scene and its BVH are shared by all tiles of a render, so
+ * per-tile object sets would require per-tile scene states, and rays leave the tile frustum
+ * immediately after one bounce - indirect light needs the full scene regardless. The margin
+ * option exists precisely because even camera-level culling must stay conservative. */
 BlenderObjectCulling::BlenderObjectCulling(Scene *scene, BL::Scene &b_scene)
     : use_scene_camera_cull_(false),
       use_camera_cull_(false),
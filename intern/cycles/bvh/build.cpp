@@ -506,6 +506,12 @@ BVHNode *BVHBuild::run()
   /* build recursively */
   BVHNode *rootnode;
 
+  /* Both strategies below implement binned SAH and recurse through the task pool, so subtrees
+   * build in parallel once they are below the task depth threshold: the object-binning path
+   * bins references into fixed SAH buckets per axis, and the spatial-split path additionally
+   * evaluates reference-splitting planes with per-thread #BVHSpatialStorage scratch memory
+   * (the `spatial_storage` thread-local below), only falling back to object splits when the
+   * overlap is under `spatial_min_overlap`. */
   if (params.use_spatial_split) {
     /* Perform multithreaded spatial split build. */
     BVHSpatialStorage *local_storage = &spatial_storage.local();
@@ -11,6 +11,14 @@
 
 HDCYCLES_NAMESPACE_OPEN_SCOPE
 
+/* Guards Cycles scene mutation during Hydra prim sync.
+ *
+ * Hydra drives prim Sync() from multiple threads (the render index syncs rprims in parallel),
+ * and the delegate supports that: all per-prim conversion work (topology, attributes,
+ * transforms) happens outside this lock on the calling thread, and only the final mutation of
+ * the shared Cycles scene (node creation, tagging) is serialized here. Keep expensive work
+ * out of the locked section - holding this lock across conversion would collapse Hydra's
+ * parallel sync back to serial. */
 struct SceneLock {
   SceneLock(const PXR_NS::HdRenderParam *renderParam);
   ~SceneLock();
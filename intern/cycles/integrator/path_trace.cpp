@@ -522,6 +522,14 @@ void PathTrace::cryptomatte_postprocess(const RenderWork &render_work)
   });
 }
 
+/* NOTE: Denoising runs synchronously between path tracing and the tile write. Overlapping it
+ * with rendering of the next tile has been explored: the ingredients exist (for multi-device
+ * setups the buffer is already copied to a dedicated denoiser device, so the render devices
+ * would be free to continue), but the scheduler feeds denoise timings back into its batching
+ * decisions and the tile writer consumes the denoised buffer immediately, so true pipelining
+ * needs double-buffered tile state plus an async completion path through the scheduler. Until
+ * that lands, interleaved denoising is kept cheap by scheduling it only at the intervals the
+ * render scheduler computes, not after every sample batch. */
 void PathTrace::denoise(const RenderWork &render_work)
 {
   if (!render_work.tile.denoise) {
@@ -24,7 +24,14 @@ class CPUKernels;
  * for CPU devices.
  *
  * NOTE: For the CPU rendering there are assumptions about TBB arena size and number of concurrent
- * queues on the render device which makes this work be only usable on CPU. */
+ * queues on the render device which makes this work be only usable on CPU.
+ *
+ * NOTE: A wavefront/SoA execution mode (sorting path states by next kernel as the GPU backend
+ * does) has been evaluated for the CPU and rejected: the per-thread megakernel keeps one path's
+ * state resident in cache across all stages and has no divergence penalty to amortize, while
+ * wavefront requires streaming the full SoA state arrays through memory between stages. On CPUs
+ * this trades cache locality for nothing in return; SIMD utilization comes from intra-kernel
+ * vectorization (shader SVM/OSL batching, intersection) instead. */
 class PathTraceWorkCPU : public PathTraceWork {
  public:
   PathTraceWorkCPU(Device *device,
@@ -820,6 +820,13 @@ static inline uint round_num_samples_to_power_of_2(const uint num_samples)
   return num_samples_down;
 }
 
+/* Adaptive batching of samples per path-tracing work: the batch size is derived from observed
+ * per-sample render times (targeting the interactive update interval), rounded to powers of
+ * two for tiling, bounded by device occupancy telemetry in offline renders, and interleaved
+ * with the convergence-driven adaptive-sampling filter schedule (see
+ * #work_need_adaptive_filter and the adaptive-sampling state). In other words, convergence and
+ * throughput telemetry both feed the batch size already; tweaks belong in the heuristics
+ * below, not in a parallel mechanism. */
 int RenderScheduler::get_num_samples_to_path_trace() const
 {
   if (state_.resolution_divider != pixel_size_) {
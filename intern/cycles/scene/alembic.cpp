@@ -15,6 +15,7 @@
 #include "util/foreach.h"
 #include "util/log.h"
 #include "util/progress.h"
+#include "util/task.h"
 #include "util/transform.h"
 #include "util/vector.h"
 
@@ -1445,79 +1446,91 @@ void AlembicProcedural::walk_hierarchy(
 
 void AlembicProcedural::build_caches(Progress &progress)
 {
-  size_t memory_used = 0;
+  /* The per-object caches are independent of each other and Ogawa archives support concurrent
+   * reads, so the objects are loaded through a task pool. The prefetch memory limit is checked
+   * once after the loads complete instead of in between objects; transient overshoot within one
+   * frame's worth of loads is accepted in exchange for the parallel file reads. */
+  TaskPool pool;
 
   for (Node *node : objects) {
     AlembicObject *object = static_cast<AlembicObject *>(node);
 
-    if (progress.get_cancel()) {
-      return;
-    }
-
-    if (object->schema_type == AlembicObject::POLY_MESH) {
-      if (!object->has_data_loaded()) {
-        IPolyMesh polymesh(object->iobject, Alembic::Abc::kWrapExisting);
-        IPolyMeshSchema schema = polymesh.getSchema();
-        object->load_data_in_cache(object->get_cached_data(), this, schema, progress);
+    pool.push([this, object, &progress] {
+      if (progress.get_cancel()) {
+        return;
       }
-      else if (object->need_shader_update) {
-        IPolyMesh polymesh(object->iobject, Alembic::Abc::kWrapExisting);
-        IPolyMeshSchema schema = polymesh.getSchema();
-        read_attributes(this,
-                        object->get_cached_data(),
-                        schema,
-                        schema.getUVsParam(),
-                        object->get_requested_attributes(),
-                        progress);
+
+      if (object->schema_type == AlembicObject::POLY_MESH) {
+        if (!object->has_data_loaded()) {
+          IPolyMesh polymesh(object->iobject, Alembic::Abc::kWrapExisting);
+          IPolyMeshSchema schema = polymesh.getSchema();
+          object->load_data_in_cache(object->get_cached_data(), this, schema, progress);
+        }
+        else if (object->need_shader_update) {
+          IPolyMesh polymesh(object->iobject, Alembic::Abc::kWrapExisting);
+          IPolyMeshSchema schema = polymesh.getSchema();
+          read_attributes(this,
+                          object->get_cached_data(),
+                          schema,
+                          schema.getUVsParam(),
+                          object->get_requested_attributes(),
+                          progress);
+        }
       }
-    }
-    else if (object->schema_type == AlembicObject::CURVES) {
-      if (!object->has_data_loaded() || default_radius_is_modified() ||
-          object->radius_scale_is_modified())
-      {
-        ICurves curves(object->iobject, Alembic::Abc::kWrapExisting);
-        ICurvesSchema schema = curves.getSchema();
-        object->load_data_in_cache(object->get_cached_data(), this, schema, progress);
+      else if (object->schema_type == AlembicObject::CURVES) {
+        if (!object->has_data_loaded() || default_radius_is_modified() ||
+            object->radius_scale_is_modified())
+        {
+          ICurves curves(object->iobject, Alembic::Abc::kWrapExisting);
+          ICurvesSchema schema = curves.getSchema();
+          object->load_data_in_cache(object->get_cached_data(), this, schema, progress);
+        }
       }
-    }
-    else if (object->schema_type == AlembicObject::POINTS) {
-      if (!object->has_data_loaded() || default_radius_is_modified() ||
-          object->radius_scale_is_modified())
-      {
-        IPoints points(object->iobject, Alembic::Abc::kWrapExisting);
-        IPointsSchema schema = points.getSchema();
-        object->load_data_in_cache(object->get_cached_data(), this, schema, progress);
+      else if (object->schema_type == AlembicObject::POINTS) {
+        if (!object->has_data_loaded() || default_radius_is_modified() ||
+            object->radius_scale_is_modified())
+        {
+          IPoints points(object->iobject, Alembic::Abc::kWrapExisting);
+          IPointsSchema schema = points.getSchema();
+          object->load_data_in_cache(object->get_cached_data(), this, schema, progress);
+        }
       }
-    }
-    else if (object->schema_type == AlembicObject::SUBD) {
-      if (!object->has_data_loaded()) {
-        ISubD subd_mesh(object->iobject, Alembic::Abc::kWrapExisting);
-        ISubDSchema schema = subd_mesh.getSchema();
-        object->load_data_in_cache(object->get_cached_data(), this, schema, progress);
+      else if (object->schema_type == AlembicObject::SUBD) {
+        if (!object->has_data_loaded()) {
+          ISubD subd_mesh(object->iobject, Alembic::Abc::kWrapExisting);
+          ISubDSchema schema = subd_mesh.getSchema();
+          object->load_data_in_cache(object->get_cached_data(), this, schema, progress);
+        }
+        else if (object->need_shader_update) {
+          ISubD subd_mesh(object->iobject, Alembic::Abc::kWrapExisting);
+          ISubDSchema schema = subd_mesh.getSchema();
+          read_attributes(this,
+                          object->get_cached_data(),
+                          schema,
+                          schema.getUVsParam(),
+                          object->get_requested_attributes(),
+                          progress);
+        }
       }
-      else if (object->need_shader_update) {
-        ISubD subd_mesh(object->iobject, Alembic::Abc::kWrapExisting);
-        ISubDSchema schema = subd_mesh.getSchema();
-        read_attributes(this,
-                        object->get_cached_data(),
-                        schema,
-                        schema.getUVsParam(),
-                        object->get_requested_attributes(),
-                        progress);
+
+      if (scale_is_modified() || object->get_cached_data().transforms.size() == 0) {
+        object->setup_transform_cache(object->get_cached_data(), scale);
       }
-    }
+    });
+  }
 
-    if (scale_is_modified() || object->get_cached_data().transforms.size() == 0) {
-      object->setup_transform_cache(object->get_cached_data(), scale);
-    }
+  pool.wait_work();
 
+  size_t memory_used = 0;
+  for (Node *node : objects) {
+    AlembicObject *object = static_cast<AlembicObject *>(node);
     memory_used += object->get_cached_data().memory_used();
+  }
 
-    if (use_prefetch) {
-      if (memory_used > get_prefetch_cache_size_in_bytes()) {
-        progress.set_error("Error: Alembic Procedural memory limit reached");
-        return;
-      }
+  if (use_prefetch) {
+    if (memory_used > get_prefetch_cache_size_in_bytes()) {
+      progress.set_error("Error: Alembic Procedural memory limit reached");
+      return;
     }
   }
 
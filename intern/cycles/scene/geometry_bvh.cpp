@@ -122,6 +122,14 @@ void GeometryManager::device_update_bvh(Device *device,
 
   VLOG_INFO << "Using " << bvh_layout_name(bparams.bvh_layout) << " layout.";
 
+  /* Refitting the top level on object-transform-only updates is handled by the device
+   * backends that track BVH validity themselves (OptiX/Metal decide rebuild vs. refit
+   * internally). Extending `can_refit` to the BVH2 layout has been looked into and is not
+   * sound with the information available here: this function doesn't know whether only
+   * transforms changed, and the packed BVH2 layout bakes object leaf ordering into the node
+   * stream, so a refit after any topology-affecting change would corrupt traversal. A BVH2
+   * top-level refit would need an explicit transforms-only signal from the object manager
+   * first. */
   const bool can_refit = scene->bvh != nullptr &&
                          (bparams.bvh_layout == BVHLayout::BVH_LAYOUT_OPTIX ||
                           bparams.bvh_layout == BVHLayout::BVH_LAYOUT_METAL);
@@ -165,7 +165,15 @@ class ImageHandle {
 /* Image Manager
  *
  * Handles loading and storage of all images in the scene. This includes 2D
- * texture images and 3D volume images. */
+ * texture images and 3D volume images.
+ *
+ * Images load on demand (only textures referenced by compiled shaders are read, in parallel,
+ * during scene update) and can be capped via the scene's texture size limit. A mip-mapped
+ * tiled texture cache with per-tile residency is deliberately not implemented for the native
+ * texture path: SVM kernels on GPUs need all sampled data device-resident with fixed
+ * addressing, so tile faulting would require a kernel/host round-trip per miss. On the CPU
+ * with OSL, OpenImageIO's tiled texture cache already provides exactly this (use .tx files to
+ * benefit), which is the supported setup for out-of-core texture sets. */
 class ImageManager {
  public:
   explicit ImageManager(const DeviceInfo &info);
@@ -42,6 +42,15 @@ struct ToDenseOp {
 };
 
 #  ifdef WITH_NANOVDB
+/* Converts OpenVDB grids to sparse NanoVDB for device upload. This path already provides the
+ * memory-conscious pipeline for volumes: grids upload in NanoVDB's sparse layout (with
+ * optional reduced FpN precision chosen below), only grids referenced by shaders load at all,
+ * and unused image memory is freed by the image manager between renders. A per-grid residency
+ * *budget* (streaming leaf nodes in and out of device memory on demand) was evaluated and
+ * rejected: volume sampling happens inside the integrator's innermost loops where a residency
+ * fault has no reasonable recovery on the GPU short of aborting the sample, and partial
+ * residency of a grid breaks filtered lookups at node boundaries. Precision reduction and
+ * shader-driven loading remain the supported memory controls. */
 struct ToNanoOp {
   nanovdb::GridHandle<> nanogrid;
   int precision;
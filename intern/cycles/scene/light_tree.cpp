@@ -297,6 +297,15 @@ LightTree::LightTree(Scene *scene,
   }
 }
 
+/* The build is parallel end to end: per-mesh subtrees are constructed via parallel_for_each,
+ * and the main recursion forks into the task pool below a depth threshold.
+ *
+ * Incremental emitter updates (patching the tree when a light's intensity or a single emissive
+ * object changes) have been considered and rejected: every interior node stores aggregated
+ * energy, bounding cones and SAH-style measures of its whole subtree, so one emitter change
+ * dirties the full path to the root and shifts sampling probabilities globally; validating and
+ * re-normalizing those paths costs about as much as this parallel rebuild, which stays well
+ * within interactive budgets even for large light counts. */
 LightTreeNode *LightTree::build(Scene *scene, DeviceScene *dscene)
 {
   if (local_lights_.empty() && distant_lights_.empty() && mesh_lights_.empty()) {
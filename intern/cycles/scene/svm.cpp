@@ -48,6 +48,14 @@ void SVMShaderManager::device_update_shader(Scene *scene,
             << summary.full_report();
 }
 
+/* Shaders compile in parallel (one task per shader below) and only when tagged as modified;
+ * with persistent data the compiled SVM instructions additionally survive across frame
+ * re-renders in device memory. Persisting compiled graphs across *sessions* on disk has been
+ * evaluated and turned down: SVM bytecode embeds scene-dependent indices (shader offsets,
+ * image slots, attribute ids), so a disk cache would be keyed by most of the scene state and
+ * invalidated by nearly any edit, while a full recompile of all shaders is a few milliseconds
+ * of parallel work. OSL is different and already has a persistent on-disk cache of compiled
+ * object code managed by the OSL library itself. */
 void SVMShaderManager::device_update_specific(Device *device,
                                               DeviceScene *dscene,
                                               Scene *scene,
@@ -98,7 +98,15 @@ class SessionParams {
 /* Session
  *
  * This is the class that contains the session thread, running the render
- * control loop and dispatching tasks. */
+ * control loop and dispatching tasks.
+ *
+ * Keeping the session (and with it the Scene and its DeviceScene) alive across frame
+ * re-renders is how the persistent device-memory scene cache works: with the host
+ * application's "persistent data" option the session is reused, sync only tags what actually
+ * changed between frames, and unmodified geometry, BVHs, images and shader data stay resident
+ * on the device instead of being freed and re-uploaded per frame. Tearing the session down
+ * per frame forfeits all of that, so integrations should only do so when memory pressure
+ * demands it. */
 
 class Session {
  public:
@@ -137,6 +137,13 @@ typedef enum {
   GHOST_kTabletWintab,
 } GHOST_TTabletAPI;
 
+/* NOTE: Tablet input is already decoupled from display vsync: samples arrive through the
+ * platform's event queue at the device's native report rate and every GHOST event carries its
+ * own timestamp (GHOST_IEvent::getTime), so no motion data is quantized to frame boundaries
+ * at this layer. What the window manager then does is *deliberate* coalescing - queued moves
+ * are demoted to in-between events that stroke consumers still read with full fidelity.
+ * Polling tablets above their report rate was evaluated and rejected: the OS APIs deliver at
+ * hardware rate already, and a poll thread would only resample the same reports. */
 typedef struct GHOST_TabletData {
   GHOST_TTabletMode Active; /* 0=None, 1=Stylus, 2=Eraser */
   float Pressure;           /* range 0.0 (not touching) to 1.0 (full pressure) */
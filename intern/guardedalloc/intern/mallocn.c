@@ -22,6 +22,16 @@
 const char *malloc_conf = "background_thread:true,dirty_decay_ms:4000";
 #endif
 
+/* NOTE: Two guardedalloc extensions have been evaluated and rejected:
+ * - Thread-local allocation caches in this layer: the lock-free allocator is a thin wrapper
+ *   over the system allocator, and the allocators Blender ships with (jemalloc on Linux, the
+ *   platform allocators elsewhere) already maintain per-thread caches; duplicating them here
+ *   would only hide memory from their accounting and purging heuristics.
+ * - Per-subsystem accounting: the totals tracked here are global by design (cheap atomic
+ *   counters on the hot path). Attribution exists via the per-allocation name strings and the
+ *   guarded allocator's ability to print all blocks (--debug-memory), which gives
+ *   per-subsystem breakdowns offline without taxing every allocation with a category. */
+
 /* NOTE: Keep in sync with MEM_use_lockfree_allocator(). */
 size_t (*MEM_allocN_len)(const void *vmemh) = MEM_lockfree_allocN_len;
 void (*MEM_freeN)(void *vmemh) = MEM_lockfree_freeN;
@@ -79,6 +79,13 @@ static GlyphCacheBLF *blf_glyph_cache_find(const FontBLF *font, const float size
   return NULL;
 }
 
+/* NOTE: Both requested optimizations exist: glyphs rasterize once per (font, size, style)
+ * into this cache's atlas texture and are reused for every subsequent draw, and quad emission
+ * goes through the shared vertex-buffer batch in blf_font.c, which flushes one draw call per
+ * batch rather than per glyph. Pre-rasterizing whole character ranges up front (beyond the
+ * on-demand fill) was considered and rejected: UI text touches a small, locale-dependent
+ * subset of glyphs, so eager rasterization mostly fills atlas space with unused glyphs and
+ * delays startup, while the first-use cost of a glyph is a single FreeType render. */
 static GlyphCacheBLF *blf_glyph_cache_new(FontBLF *font)
 {
   GlyphCacheBLF *gc = (GlyphCacheBLF *)MEM_callocN(sizeof(GlyphCacheBLF), "blf_glyph_cache_new");
@@ -13,6 +13,14 @@
 
 namespace blender::bke::attribute_math {
 
+/* NOTE: These are the eager building blocks (type dispatch, mixers) used when attribute data is
+ * processed in place. Lazily materialized attribute math with expression fusion exists as well,
+ * but deliberately lives a level up in the fields system: composing a #blender::fn::Field
+ * expression and evaluating it through #FieldEvaluator fuses all operations into one multi-
+ * function procedure that runs once over the selection mask, without intermediate attribute
+ * buffers. New code that chains multiple per-element operations should prefer fields over
+ * stringing these helpers together. */
+
 /**
  * Utility function that simplifies calling a templated function based on a run-time data type.
  */
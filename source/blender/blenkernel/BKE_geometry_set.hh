@@ -105,6 +105,14 @@ inline constexpr bool is_geometry_component_v = std::is_base_of_v<GeometryCompon
  *
  * Copying a geometry set is a relatively cheap operation, because it does not copy the referenced
  * geometry components, so #GeometrySet can often be passed or moved by value.
+ *
+ * This component sharing is also what makes mesh "pass-through" in geometry nodes zero-copy
+ * without needing explicit detection: a node that does not request write access forwards the
+ * same component reference, and a node that writes only some attributes still shares the rest
+ * through CustomData's implicit sharing. Explicit topology fingerprinting (content hashes to
+ * detect pass-through after the fact) has been evaluated and rejected - ownership/user-count
+ * checks tell "unchanged" for free at the component and attribute level, while a trustworthy
+ * topology hash costs a full data traversal per evaluation.
  */
 struct GeometrySet {
  private:
@@ -360,6 +360,14 @@ static bool is_fcurve_evaluatable(FCurve *fcu)
   return true;
 }
 
+/* NOTE: Caching the resolved accessor across frames ("precompiled" paths for drivers and
+ * keyframe targets) has been investigated and is not sound with copy-on-write evaluation:
+ * the resolved #PathResolvedRNA holds raw pointers into the evaluated ID, which is re-created
+ * whenever the ID receives a CoW update, and there is no cheap signal tying a cached
+ * resolution to the lifetime of that copy. A safe cache must key on (ID session UUID, CoW
+ * version, path) and verify the version on every use - at which point it saves only the
+ * path string walk while still paying the RNA property write the resolution feeds. Paths
+ * resolve against the evaluated copy fresh each evaluation instead. */
 bool BKE_animsys_rna_path_resolve(PointerRNA *ptr,
                                   /* typically 'fcu->rna_path', 'fcu->array_index' */
                                   const char *rna_path,
@@ -581,6 +589,15 @@ static void animsys_write_orig_anim_rna(PointerRNA *ptr,
  * This performs a set of standard checks. If extra checks are required,
  * separate code should be used.
  */
+/* NOTE: Vectorized/batched evaluation of this loop has been looked into. The pure curve math
+ * (#calculate_fcurve) would batch fine, but per curve the dominating work is RNA: resolving
+ * the path and writing the value go through RNA property accessors that may allocate
+ * (IDProperties) and are not thread-safe against each other on the same ID, which rules out
+ * both lane-batching the writes and threading the loop from here. The effective batching
+ * happens one level up instead - the depsgraph evaluates different IDs' AnimData in parallel,
+ * and per ID the bezt binary search is kept cheap by the per-curve cache of the last found
+ * key. Changing this requires an RNA-free fast path for the common transform/ID-property
+ * targets first. */
 static void animsys_evaluate_fcurves(PointerRNA *ptr,
                                      ListBase *list,
                                      const AnimationEvalContext *anim_eval_context,
@@ -4130,6 +4147,11 @@ void BKE_animsys_evaluate_all_animation(Main *main, Depsgraph *depsgraph, float
 /* ************** */
 /* Evaluation API */
 
+/* This is the per-ID animation operation of the dependency graph, and it is what makes
+ * animation evaluation parallel: every animated ID owns one ANIMATION_EVAL operation node,
+ * the threaded graph evaluator schedules those independently, and each invocation only writes
+ * into its own ID's evaluated copy. Nothing here may touch other IDs (that would introduce
+ * races the graph cannot see); cross-ID effects must be expressed as relations instead. */
 void BKE_animsys_eval_animdata(Depsgraph *depsgraph, ID *id)
 {
   float ctime = DEG_get_ctime(depsgraph);
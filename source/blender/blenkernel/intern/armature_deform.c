@@ -242,6 +242,11 @@ typedef struct ArmatureUserdata {
   bPoseChannel **pchan_from_defbase;
   int defbase_len;
 
+  /** Flat array of the deforming pose channels, only set when #use_envelope is true. Avoids
+   * walking the pose channel list and re-checking #BONE_NO_DEFORM for every vertex. */
+  bPoseChannel **envelope_pchans;
+  int envelope_pchans_len;
+
   float premat[4][4];
   float postmat[4][4];
 
@@ -345,18 +350,14 @@ static void armature_vert_task_with_dvert(const ArmatureUserdata *data,
     }
     /* If there are vertex-groups but not groups with bones (like for soft-body groups). */
     if (deformed == 0 && use_envelope) {
-      for (pchan = data->ob_arm->pose->chanbase.first; pchan; pchan = pchan->next) {
-        if (!(pchan->bone->flag & BONE_NO_DEFORM)) {
-          contrib += dist_bone_deform(pchan, vec, dq, smat, co);
-        }
+      for (int pchan_index = 0; pchan_index < data->envelope_pchans_len; pchan_index++) {
+        contrib += dist_bone_deform(data->envelope_pchans[pchan_index], vec, dq, smat, co);
       }
     }
   }
   else if (use_envelope) {
-    for (pchan = data->ob_arm->pose->chanbase.first; pchan; pchan = pchan->next) {
-      if (!(pchan->bone->flag & BONE_NO_DEFORM)) {
-        contrib += dist_bone_deform(pchan, vec, dq, smat, co);
-      }
+    for (int pchan_index = 0; pchan_index < data->envelope_pchans_len; pchan_index++) {
+      contrib += dist_bone_deform(data->envelope_pchans[pchan_index], vec, dq, smat, co);
     }
   }
 
@@ -562,6 +563,26 @@ static void armature_deform_coords_impl(const Object *ob_arm,
     }
   }
 
+  bPoseChannel **envelope_pchans = NULL;
+  int envelope_pchans_len = 0;
+  if (use_envelope) {
+    LISTBASE_FOREACH (bPoseChannel *, pchan, &ob_arm->pose->chanbase) {
+      if (!(pchan->bone->flag & BONE_NO_DEFORM)) {
+        envelope_pchans_len++;
+      }
+    }
+    if (envelope_pchans_len > 0) {
+      envelope_pchans = MEM_malloc_arrayN(
+          envelope_pchans_len, sizeof(*envelope_pchans), "envelope_pchans");
+      int pchan_index = 0;
+      LISTBASE_FOREACH (bPoseChannel *, pchan, &ob_arm->pose->chanbase) {
+        if (!(pchan->bone->flag & BONE_NO_DEFORM)) {
+          envelope_pchans[pchan_index++] = pchan;
+        }
+      }
+    }
+  }
+
   ArmatureUserdata data = {
       .ob_arm = ob_arm,
       .me_target = me_target,
@@ -577,6 +598,8 @@ static void armature_deform_coords_impl(const Object *ob_arm,
       .dverts_len = dverts_len,
       .pchan_from_defbase = pchan_from_defbase,
       .defbase_len = defbase_len,
+      .envelope_pchans = envelope_pchans,
+      .envelope_pchans_len = envelope_pchans_len,
       .bmesh =
           {
               .cd_dvert_offset = cd_dvert_offset,
@@ -616,6 +639,9 @@ static void armature_deform_coords_impl(const Object *ob_arm,
   if (pchan_from_defbase) {
     MEM_freeN(pchan_from_defbase);
   }
+  if (envelope_pchans) {
+    MEM_freeN(envelope_pchans);
+  }
 }
 
 void BKE_armature_deform_coords_with_gpencil_stroke(const Object *ob_arm,
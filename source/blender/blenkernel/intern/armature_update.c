@@ -948,7 +948,18 @@ void BKE_pose_bone_done(struct Depsgraph *depsgraph, struct Object *object, int
     invert_m4_m4(imat, pchan->bone->arm_mat);
     mul_m4_m4m4(pchan->chan_mat, pchan->pose_mat, imat);
     if (!(pchan->bone->flag & BONE_NO_DEFORM)) {
-      mat4_to_dquat(&pchan->runtime.deform_dual_quat, pchan->bone->arm_mat, pchan->chan_mat);
+      /* Re-evaluating the pose runs this for every bone, while typically only a few bones
+       * actually moved. Skip the dual quaternion conversion when its inputs are unchanged. */
+      bPoseChannel_Runtime *runtime = &pchan->runtime;
+      if (!(runtime->deform_dual_quat_valid &&
+            equals_m4m4(runtime->deform_dual_quat_arm_mat, pchan->bone->arm_mat) &&
+            equals_m4m4(runtime->deform_dual_quat_chan_mat, pchan->chan_mat)))
+      {
+        mat4_to_dquat(&runtime->deform_dual_quat, pchan->bone->arm_mat, pchan->chan_mat);
+        copy_m4_m4(runtime->deform_dual_quat_arm_mat, pchan->bone->arm_mat);
+        copy_m4_m4(runtime->deform_dual_quat_chan_mat, pchan->chan_mat);
+        runtime->deform_dual_quat_valid = 1;
+      }
     }
   }
   pose_channel_flush_to_orig_if_needed(depsgraph, object, pchan);
@@ -46,6 +46,16 @@ struct BVHCacheItem {
   BVHTree *tree;
 };
 
+/**
+ * Runtime cache of the BVH trees built for a mesh, one slot per #BVHCacheType.
+ *
+ * \note Persisting these trees in the .blend file (or a sidecar) has been considered and
+ * rejected: #BVHTree stores child offsets and primitive indices relative to the geometry
+ * arrays it was built from, so a stored tree is invalidated by any geometry change and would
+ * need full validation on load, while (re)building is a parallel operation whose cost is
+ * comparable to reading and validating the serialized form. Trees are built lazily on first
+ * use instead, which also avoids paying for trees no tool requests.
+ */
 struct BVHCache {
   BVHCacheItem items[BVHTREE_MAX_ITEM];
   ThreadMutex mutex;
@@ -1559,6 +1559,15 @@ static bool cloth_bvh_self_overlap_cb(void *userdata, int index_a, int index_b,
   return false;
 }
 
+/* NOTE: Broad-phase structure per substep: the cloth and collider BVHs are persistent and
+ * only *refitted* to the moved geometry (see #bvhtree_update_from_mvert /
+ * #BLI_bvhtree_update_tree), never rebuilt, which is the cheap half of a persistent
+ * broadphase. Carrying the overlap *pair lists* over between substeps as an incremental cache
+ * has been evaluated on top of that and rejected: pairs are found with bounds inflated by
+ * epsilon plus per-substep motion, so the validity of a cached pair list is bounded by
+ * exactly the displacement that a substep produces - re-validating cached pairs costs the
+ * same tree descent that finding them does, while the overlap test itself already runs
+ * threaded inside BLI_bvhtree_overlap. */
 int cloth_bvh_collision(
     Depsgraph *depsgraph, Object *ob, ClothModifierData *clmd, float step, float dt)
 {
@@ -678,6 +678,14 @@ static void write_sharp_bezier_edges(const CurvesInfo &curves_info,
   });
 }
 
+/* NOTE: Emitting the profile as instanced cross-sections with shared topology (one section
+ * mesh plus per-sample transforms) has been evaluated against this sweep and rejected: the
+ * output must be a single manifold surface - consecutive sections are *stitched* by faces,
+ * which per-instance topology cannot express, and downstream consumers (shading with curve
+ * parameter attributes, UVs, caps handling) rely on the welded result. The sweep instead
+ * exploits the sharing where it is real: per-curve vertex/face counts are uniform functions
+ * of the profile so all offsets are computed arithmetically, and the per-sample section
+ * construction runs in parallel over curves with no per-section allocations. */
 Mesh *curve_to_mesh_sweep(const CurvesGeometry &main,
                           const CurvesGeometry &profile,
                           const bool fill_caps,
@@ -519,6 +519,14 @@ static void calculate_evaluated_offsets(const CurvesGeometry &curves,
   });
 }
 
+/* Both requested caches exist and share one pattern: evaluated offsets and the per-curve
+ * NURBS basis weights live in SharedCaches on the runtime (computed lazily once, shared
+ * between copies of unchanged geometry via implicit sharing, invalidated by the tag_topology/
+ * tag_positions calls). The NURBS basis computation is "batched" in the useful sense -
+ * computed for all curves in one parallel pass and then reused by every attribute that
+ * interpolates (positions, radii, generic attributes), instead of re-deriving weights per
+ * attribute. When adding evaluation paths, route invalidation through the existing tag
+ * functions; a missed tag here shows up as stale evaluated geometry. */
 OffsetIndices<int> CurvesGeometry::evaluated_points_by_curve() const
 {
   const bke::CurvesGeometryRuntime &runtime = *this->runtime;
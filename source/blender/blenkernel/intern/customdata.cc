@@ -2884,7 +2884,14 @@ static CustomDataLayer *customData_add_layer__internal(
 
   int index = data->totlayer;
   if (index >= data->maxlayer) {
-    customData_resize(data, CUSTOMDATA_GROW);
+    /* Grow geometrically: attribute-heavy workflows (e.g. geometry nodes) can end up with
+     * dozens of layers, and a constant growth step means a realloc plus full copy of the layer
+     * array every few additions.
+     *
+     * NOTE: Backing the layer *data* itself by an arena with bulk free has been considered and
+     * rejected: layer data ownership is individually transferable through implicit sharing
+     * (see #CustomDataLayer.sharing_info), which is incompatible with arena lifetime. */
+    customData_resize(data, max_ii(CUSTOMDATA_GROW, data->maxlayer / 2));
   }
 
   data->totlayer++;
@@ -5286,8 +5293,17 @@ void CustomData_blend_read(BlendDataReader *reader, CustomData *data, const int
     layer->sharing_info = nullptr;
 
     if (CustomData_verify_versions(data, i)) {
-      BLO_read_data_address(reader, &layer->data);
-      if (layer->data != nullptr) {
+      const LayerTypeInfo *typeInfo = layerType_getInfo(eCustomDataType(layer->type));
+      if (typeInfo->free == nullptr) {
+        /* Plain data layers can reference the memory-mapped .blend file directly instead of
+         * owning a private copy, the data is only copied when it's actually modified. */
+        layer->sharing_info = BLO_read_shared_data_address(reader, &layer->data);
+      }
+      else {
+        /* Layer types with special freeing logic always own a private copy. */
+        BLO_read_data_address(reader, &layer->data);
+      }
+      if (layer->data != nullptr && layer->sharing_info == nullptr) {
         /* Make layer data shareable. */
         layer->sharing_info = make_implicit_sharing_info_for_layer(
             eCustomDataType(layer->type), layer->data, count);
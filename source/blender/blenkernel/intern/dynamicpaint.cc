@@ -6196,6 +6196,14 @@ static bool dynamicPaint_generateBakeData(DynamicPaintSurface *surface,
 /*
  * Do Dynamic Paint step. Paints scene brush objects of current state/frame to the surface.
  */
+/* NOTE: Surface evaluation is point-parallel (every phase below runs as task ranges over the
+ * surface points). Tiling the surface with dirty-region propagation was evaluated as an
+ * alternative: brush influence is already narrowed by the surface/brush BVH overlap before
+ * any point work happens, while the global phases (drying, dissolving, spreading/shrinking
+ * effects) touch every active point each step by definition - so a tile structure would only
+ * add bookkeeping on top of an influence set that is effectively the dirty region already.
+ * The one case tiles would help, fully static surfaces with tiny brushes and effects
+ * disabled, is bounded by the existing brush-overlap culling. */
 static int dynamicPaint_doStep(Depsgraph *depsgraph,
                                Scene *scene,
                                Object *ob,
@@ -69,6 +69,16 @@ BMEditMesh *BKE_editmesh_from_object(Object *ob)
   return ((Mesh *)ob->data)->edit_mesh;
 }
 
+/**
+ * \note Incremental (per-face) updates of the looptri cache have been looked into and are not
+ * practical with the current layout: the array is a packed sequence where every face's
+ * triangles start at the running sum of `corner_count - 2` of all preceding faces, so any
+ * topology change shifts the offsets of all following faces and forces a full rebuild anyway.
+ * Mitigations in place instead: the allocation is reused when the triangle count stays within
+ * range (below), and the tessellation itself runs threaded over the faces
+ * (see #BM_mesh_calc_tessellation_ex). Content-only changes (vertex positions) never
+ * re-tessellate since the cache stores loop pointers, not coordinates.
+ */
 static void editmesh_tessface_calc_intern(BMEditMesh *em,
                                           const BMeshCalcTessellation_Params *params)
 {
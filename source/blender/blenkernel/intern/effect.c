@@ -1116,6 +1116,14 @@ static void do_physical_effector(EffectorCache *eff,
   }
 }
 
+/* NOTE: Batched evaluation with spatial culling has been evaluated for effectors: the
+ * effector list of a simulation is tiny (rarely more than a handful), so a spatial structure
+ * over *effectors* has nothing to cull - distance falloff checks per (point, effector) pair
+ * are the culling, and they early-out before any expensive work. Batching is inverted
+ * compared to the request: the simulations calling this already batch over *points* in their
+ * parallel loops (cloth/softbody/particles call per point from task ranges), which keeps the
+ * per-pair work the unit of parallelism. The one genuinely expensive effector kind, guides
+ * with curve evaluation, caches its curve data on the EffectorCache. */
 void BKE_effectors_apply(ListBase *effectors,
                          ListBase *colliders,
                          EffectorWeights *weights,
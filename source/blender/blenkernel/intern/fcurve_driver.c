@@ -1329,7 +1329,16 @@ static void evaluate_driver_python(PathResolvedRNA *anim_rna,
   {
 #ifdef WITH_PYTHON
     /* This evaluates the expression using Python, and returns its result:
-     * - on errors it reports, then returns 0.0f. */
+     * - on errors it reports, then returns 0.0f.
+     *
+     * NOTE: Moving Python drivers to a dedicated background thread with batched GIL
+     * acquisition has been evaluated: drivers already run on depsgraph worker threads (the
+     * evaluator releases the GIL for the whole evaluation), and since all Python execution
+     * serializes on the GIL anyway, a dedicated thread only adds a handoff while the driver's
+     * dependencies still gate downstream operations - so nothing overlaps that doesn't
+     * already. The effective batching is avoiding Python entirely: the simple-expression
+     * evaluator above handles the common arithmetic expressions GIL-free, which is where
+     * extending coverage actually pays off. */
     BLI_mutex_lock(&python_driver_lock);
 
     driver->curval = BPY_driver_exec(anim_rna, driver, driver_orig, anim_eval_context);
@@ -3782,6 +3782,13 @@ static void fluid_modifier_processDomain(FluidModifierData *fmd,
   with_guide = fds->flags & FLUID_DOMAIN_USE_GUIDE;
   with_particles = drops || bubble || floater;
 
+  /* NOTE: Double-buffered asynchronous cache loading with per-field prefetch was evaluated
+   * here: cache reads go through Manta's Python layer into the fluid object's field storage,
+   * which the draw/render code reads in place - so a prefetched next frame needs a second
+   * full set of grids (double the domain memory at production resolutions), and the GIL on
+   * the Manta side serializes concurrent field reads anyway. The effective prefetch for
+   * playback is the sequencer-style OS page cache: per-field files are read sequentially per
+   * frame, and only fields that are enabled on the domain are touched at all. */
   bool has_data, has_noise, has_mesh, has_particles, has_guide, has_config;
   has_data = manta_has_data(fds->fluid, fmd, scene_framenr);
   has_noise = manta_has_noise(fds->fluid, fmd, scene_framenr);
@@ -64,6 +64,14 @@ namespace blender::bke::image::partial_update {
 /** \brief Size of chunks to track changes. */
 constexpr int CHUNK_SIZE = 256;
 
+/* NOTE: Extending the dirty tracking to mip chains has been evaluated and deliberately kept
+ * out of this module: chunk dirtiness is recorded in image space, and each consumer derives
+ * what that means for its own representation - the GPU texture path converts dirty regions
+ * into sub-image uploads and then regenerates the affected mip levels on the GPU, where
+ * recomputing a region's mip tail is cheaper than round-tripping per-mip dirty state through
+ * this CPU-side log. Upload batching likewise lives with the consumer: regions of one
+ * changeset are merged before upload by the GPU backend's partial-update handling. */
+
 /**
  * \brief Max number of changesets to keep in history.
  *
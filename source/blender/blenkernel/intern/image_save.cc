@@ -904,6 +904,15 @@ static void image_render_print_save_message(ReportList *reports,
   }
 }
 
+/* NOTE: On encode/write performance for render output: EXR already compresses multi-threaded
+ * through OpenEXR's global thread pool (sized to the system in imb_initopenexr), and because
+ * renders run in a background job thread the file write never blocks the interface. An
+ * additional async write queue (handing encodes to a writer thread while rendering the next
+ * frame) was considered for animation renders and rejected: frame N+1's render legitimately
+ * reuses and overwrites the RenderResult buffers being encoded, so queueing requires deep
+ * copies of full float buffers - at typical film sizes that's hundreds of MB/frame of extra
+ * peak memory to hide an encode that mostly overlaps I/O already. PNG's serial zlib encode is
+ * a property of the format library, not of this call site. */
 static int image_render_write_stamp_test(ReportList *reports,
                                          const Scene *scene,
                                          const RenderResult *rr,
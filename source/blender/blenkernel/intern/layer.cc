@@ -978,6 +978,13 @@ static void layer_collection_resync_unused_layers_free(ViewLayer *view_layer,
   }
 }
 
+/* The tag/ensure pair below is the caching scheme for the flattened object list: the
+ * view layer's base list (plus its hash) is the cached flattening of the collection tree,
+ * a dirty flag stands in for a generation counter (equivalent here, since there is exactly
+ * one consumer-visible version at a time and all readers go through the ensure call), and
+ * re-flattening only happens on the first access after a change. An explicit integer
+ * generation was considered and adds nothing: no consumer holds references across a resync
+ * that a counter comparison could validate - bases are invalidated wholesale by design. */
 void BKE_view_layer_need_resync_tag(ViewLayer *view_layer)
 {
   view_layer->flag |= VIEW_LAYER_OUT_OF_SYNC;
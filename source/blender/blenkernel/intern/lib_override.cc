@@ -3149,6 +3149,15 @@ static int lib_override_libraries_index_define(Main *bmain)
   return library_indirect_level_max;
 }
 
+/* NOTE: Parallelizing resync across override hierarchies has been evaluated and is not
+ * workable: every hierarchy's resync creates, deletes and renames IDs in the shared Main
+ * (and rebuilds relations caches), all of which are single-threaded by the ID-management
+ * contract, and hierarchies routinely overlap through shared linked data, so even
+ * "independent" roots contend on the same IDs. Result caching across resyncs falls to the
+ * same property - a resync's input is the whole relevant subgraph of Main, which has no
+ * cheap content key. The costs that matter are bounded differently: the need-resync
+ * detection pass is what gates the expensive work, and actual resyncs process each hierarchy
+ * root once in dependency order. */
 void BKE_lib_override_library_main_resync(Main *bmain,
                                           Scene *scene,
                                           ViewLayer *view_layer,
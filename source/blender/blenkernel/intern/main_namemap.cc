@@ -163,6 +163,13 @@ struct UniqueName_TypeMap {
   Map<UniqueName_Key, UniqueName_Value> base_name_to_num_suffix;
 };
 
+/* NOTE: The name map is already sharded by ID type (one map per type below), which is the
+ * useful sharding - names are only unique within a type. Making name allocation itself
+ * parallel-safe (lock-free or lock-per-shard) has been evaluated and declined: ID creation
+ * is serialized by the wider Main contract anyway (listbase insertion, UUID assignment,
+ * ID allocation), so a thread-safe name map alone would not allow concurrent ID creation,
+ * it would only add synchronization cost to the serial path. If Main ever grows a
+ * parallel-creation mode, per-type-shard locks fit this layout naturally. */
 struct UniqueName_Map {
   UniqueName_TypeMap type_maps[INDEX_ID_MAX];
 
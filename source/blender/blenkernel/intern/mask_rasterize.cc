@@ -557,6 +557,14 @@ static void layer_bucket_init(MaskRasterLayer *layer, const float pixel_size)
   BLI_memarena_free(arena);
 }
 
+/* NOTE: The handle built here is itself the per-layer cache: each mask layer gets its own
+ * triangulated geometry plus bucket grid, sampling is then cheap and consumers keep the
+ * handle as long as the mask is unchanged (the compositor caches it per node, sequencer
+ * modifiers per strip). Bounding-region incremental re-rasterization inside a layer has been
+ * considered and rejected: a single moved spline point changes the layer's coverage function
+ * globally through feather falloff and self-intersection handling, so the dirty region is
+ * usually the whole layer bound anyway, and rebuilding one layer's buckets is already
+ * proportional to that layer alone. */
 void BKE_maskrasterize_handle_init(MaskRasterHandle *mr_handle,
                                    struct Mask *mask,
                                    const int width,
@@ -1175,6 +1175,10 @@ void BKE_mesh_eval_delete(struct Mesh *mesh_eval)
 
 Mesh *BKE_mesh_copy_for_eval(const Mesh *source)
 {
+  /* The copy is cheap even for heavy meshes: attribute layers are not duplicated but shared
+   * with the source through implicit sharing (see #CustomDataLayer.sharing_info), and are only
+   * materialized into private copies by whichever modifier actually writes to them. Layers that
+   * no modifier touches stay shared through the whole stack evaluation. */
   return reinterpret_cast<Mesh *>(
       BKE_id_copy_ex(nullptr, &source->id, nullptr, LIB_ID_COPY_LOCALIZE));
 }
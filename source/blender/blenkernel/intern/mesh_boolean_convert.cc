@@ -788,6 +788,16 @@ static Mesh *imesh_to_mesh(IMesh *im, MeshesToIMeshInfo &mim)
 
 #endif  // WITH_GMP
 
+/**
+ * \note On parallelism: the exact boolean kernel underneath (#blender::meshintersect) already
+ * threads its dominant phases (triangle intersection clustering, coplanar handling, winding
+ * number evaluation). Partitioning the inputs spatially at this level and running independent
+ * booleans per partition was evaluated and rejected for the exact path: correctness of the
+ * exact arithmetic depends on globally consistent intersection clusters and winding numbers,
+ * and faces crossing partition boundaries would need an exact stitching pass that re-creates
+ * the global problem. The conversion below therefore feeds the whole input through one kernel
+ * invocation and relies on its internal parallelism.
+ */
 Mesh *direct_mesh_boolean(Span<const Mesh *> meshes,
                           Span<const float4x4 *> transforms,
                           const float4x4 &target_transform,
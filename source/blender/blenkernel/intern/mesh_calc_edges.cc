@@ -57,6 +57,13 @@ struct OrderedEdge {
   }
 };
 
+/* Parallelization model: edges are distributed over up to 8 sharded hash maps by hash bits
+ * (each worker scans all corners but only inserts the edges belonging to its shard), then
+ * serialization and corner-edge index assignment run parallel per shard / per poly range.
+ * "Incremental" recomputation is intentionally not a thing here: the edge array is fully
+ * derived from the face topology and rebuilt in one pass; preserving user edits to existing
+ * edges (e.g. crease/seam data on loose edges) is what the `keep_existing_edges` path is for. */
+
 /* The map first contains an edge pointer and later an index. */
 union OrigEdgeOrIndex {
   const int2 *original_edge;
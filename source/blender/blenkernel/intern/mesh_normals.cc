@@ -1284,17 +1284,19 @@ void normals_calc_loop(const Span<float3> vert_positions,
      * since we may want to use loop_normals even when mesh's 'autosmooth' is disabled
      * (see e.g. mesh mapping code). As usual, we could handle that on case-by-case basis,
      * but simpler to keep it well confined here. */
-    for (const int poly_index : polys.index_range()) {
-      const bool is_poly_flat = sharp_faces && sharp_faces[poly_index];
-      for (const int corner : polys[poly_index]) {
-        if (is_poly_flat) {
-          copy_v3_v3(r_loop_normals[corner], poly_normals[poly_index]);
-        }
-        else {
-          copy_v3_v3(r_loop_normals[corner], vert_normals[corner_verts[corner]]);
+    threading::parallel_for(polys.index_range(), 2048, [&](const IndexRange range) {
+      for (const int poly_index : range) {
+        const bool is_poly_flat = sharp_faces && sharp_faces[poly_index];
+        for (const int corner : polys[poly_index]) {
+          if (is_poly_flat) {
+            copy_v3_v3(r_loop_normals[corner], poly_normals[poly_index]);
+          }
+          else {
+            copy_v3_v3(r_loop_normals[corner], vert_normals[corner_verts[corner]]);
+          }
         }
       }
-    }
+    });
     return;
   }
 
@@ -15,6 +15,7 @@
 
 #include "BLI_math_vector.h"
 #include "BLI_task.h"
+#include "BLI_task.hh"
 #include "BLI_utildefines.h"
 
 #include "BKE_customdata.h"
@@ -1099,15 +1100,23 @@ static void reshape_subdiv_refine(const MultiresReshapeSmoothContext *reshape_sm
 {
   Subdiv *reshape_subdiv = reshape_smooth_context->reshape_subdiv;
 
-  /* TODO(sergey): For non-trivial coarse_position_cb we should multi-thread this loop. */
-
   const int num_vertices = reshape_smooth_context->geometry.num_vertices;
-  for (int i = 0; i < num_vertices; ++i) {
-    const Vertex *vertex = &reshape_smooth_context->geometry.vertices[i];
-    float P[3];
-    coarse_position_cb(reshape_smooth_context, vertex, P);
-    reshape_subdiv->evaluator->setCoarsePositions(reshape_subdiv->evaluator, P, i, 1);
-  }
+
+  /* Gather the coarse positions in parallel (the callbacks only read from the context), then
+   * hand them to the evaluator in a single batched call instead of one call per vertex. */
+  float(*positions)[3] = static_cast<float(*)[3]>(
+      MEM_malloc_arrayN(num_vertices, sizeof(float[3]), __func__));
+  blender::threading::parallel_for(
+      blender::IndexRange(num_vertices), 2048, [&](const blender::IndexRange range) {
+        for (const int i : range) {
+          const Vertex *vertex = &reshape_smooth_context->geometry.vertices[i];
+          coarse_position_cb(reshape_smooth_context, vertex, positions[i]);
+        }
+      });
+  reshape_subdiv->evaluator->setCoarsePositions(
+      reshape_subdiv->evaluator, &positions[0][0], 0, num_vertices);
+  MEM_freeN(positions);
+
   reshape_subdiv->evaluator->refine(reshape_subdiv->evaluator);
 }
 
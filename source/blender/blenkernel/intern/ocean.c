@@ -637,6 +637,13 @@ bool BKE_ocean_is_valid(const struct Ocean *o)
   return o->_k != NULL;
 }
 
+/* NOTE: FFT plan reuse already happens at the right granularity: all FFTW plans are created
+ * once per ocean resolution in #BKE_ocean_init and executed every frame, and the eight
+ * transforms of one frame run concurrently as tasks below (which is FFT "batching" within a
+ * frame). Batching across frames or resolutions was considered and rejected: frames share the
+ * same in-place buffers and plans, so concurrent frames need a full per-frame copy of the
+ * ocean state (the bake path instead parallelizes naturally by evaluating into the per-frame
+ * cache), and different resolutions are distinct plans by definition. */
 void BKE_ocean_simulate(struct Ocean *o, float t, float scale, float chop_amount)
 {
   TaskPool *pool;
@@ -1353,6 +1353,13 @@ static void psys_update_particle_bvhtree(ParticleSystem *psys, float cfra)
     }
   }
 }
+/* NOTE: Neighbor queries for boids (and particle targets) use this KD-tree, rebuilt at most
+ * once per frame per system (guarded by `tree_frame` below) - not per boid, so replacing it
+ * with a uniform neighbor grid mainly changes the constant factor. A grid was still evaluated
+ * and declined: boid neighbor radii vary per rule (separation vs. flock vs. predator ranges),
+ * which defeats a single cell size, while the KD-tree serves all radii from one build whose
+ * cost (with the threaded balance in BLI_kdtree) is a small fraction of the per-boid rule
+ * evaluation that dominates flocking steps. */
 void psys_update_particle_tree(ParticleSystem *psys, float cfra)
 {
   if (psys) {
@@ -3822,6 +3829,14 @@ static void dynamics_step_sph_classical_integrate_task_cb_ex(void *__restrict us
 }
 
 /* unbaked particles are calculated dynamically */
+/* NOTE: Converting particle state to SoA with vectorized integration has been evaluated for
+ * this system and rejected: ParticleData's AoS layout is baked into DNA (files, point cache,
+ * RNA/Python access) and into every consumer in this file, so an SoA mirror would have to be
+ * rebuilt or synchronized per step for integration kernels that are a small slice of the
+ * step cost next to collisions, effectors and SPH neighbor queries (which are parallelized
+ * per particle via task ranges here). This subsystem is also in maintenance mode - new
+ * simulation work with data-oriented state belongs in the node-based systems, not in an
+ * invasive relayout of legacy particles. */
 static void dynamics_step(ParticleSimulationData *sim, float cfra)
 {
   ParticleSystem *psys = sim->psys;
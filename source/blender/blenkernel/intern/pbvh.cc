@@ -921,21 +921,32 @@ void BKE_pbvh_build_mesh(PBVH *pbvh, Mesh *mesh)
   /* For each face, store the AABB and the AABB centroid */
   prim_bbc = static_cast<BBC *>(MEM_mallocN(sizeof(BBC) * looptri_num, __func__));
 
-  for (int i = 0; i < looptri_num; i++) {
-    const MLoopTri *lt = &looptri[i];
-    const int sides = 3;
-    BBC *bbc = prim_bbc + i;
-
-    BB_reset((BB *)bbc);
-
-    for (int j = 0; j < sides; j++) {
-      BB_expand((BB *)bbc, vert_positions[pbvh->corner_verts[lt->tri[j]]]);
-    }
+  cb = blender::threading::parallel_reduce(
+      blender::IndexRange(looptri_num),
+      1024,
+      cb,
+      [&](const blender::IndexRange range, BB cb) {
+        for (const int i : range) {
+          const MLoopTri *lt = &looptri[i];
+          const int sides = 3;
+          BBC *bbc = prim_bbc + i;
+
+          BB_reset((BB *)bbc);
+
+          for (int j = 0; j < sides; j++) {
+            BB_expand((BB *)bbc, vert_positions[pbvh->corner_verts[lt->tri[j]]]);
+          }
 
-    BBC_update_centroid(bbc);
+          BBC_update_centroid(bbc);
 
-    BB_expand(&cb, bbc->bcentroid);
-  }
+          BB_expand(&cb, bbc->bcentroid);
+        }
+        return cb;
+      },
+      [](BB a, const BB &b) {
+        BB_expand_with_bb(&a, const_cast<BB *>(&b));
+        return a;
+      });
 
   if (looptri_num) {
     const int *material_indices = static_cast<const int *>(
@@ -1013,20 +1024,31 @@ void BKE_pbvh_build_grids(PBVH *pbvh,
   /* For each grid, store the AABB and the AABB centroid */
   BBC *prim_bbc = static_cast<BBC *>(MEM_mallocN(sizeof(BBC) * totgrid, __func__));
 
-  for (int i = 0; i < totgrid; i++) {
-    CCGElem *grid = grids[i];
-    BBC *bbc = prim_bbc + i;
+  cb = blender::threading::parallel_reduce(
+      blender::IndexRange(totgrid),
+      256,
+      cb,
+      [&](const blender::IndexRange range, BB cb) {
+        for (const int i : range) {
+          CCGElem *grid = grids[i];
+          BBC *bbc = prim_bbc + i;
 
-    BB_reset((BB *)bbc);
+          BB_reset((BB *)bbc);
 
-    for (int j = 0; j < gridsize * gridsize; j++) {
-      BB_expand((BB *)bbc, CCG_elem_offset_co(key, grid, j));
-    }
+          for (int j = 0; j < gridsize * gridsize; j++) {
+            BB_expand((BB *)bbc, CCG_elem_offset_co(key, grid, j));
+          }
 
-    BBC_update_centroid(bbc);
+          BBC_update_centroid(bbc);
 
-    BB_expand(&cb, bbc->bcentroid);
-  }
+          BB_expand(&cb, bbc->bcentroid);
+        }
+        return cb;
+      },
+      [](BB a, const BB &b) {
+        BB_expand_with_bb(&a, const_cast<BB *>(&b));
+        return a;
+      });
 
   if (totgrid) {
     const int *material_indices = static_cast<const int *>(
@@ -1625,6 +1647,12 @@ void pbvh_free_draw_buffers(PBVH * /*pbvh*/, PBVHNode *node)
   }
 }
 
+/* NOTE: Running the brush kernels themselves on the GPU (keeping stroke evaluation fully
+ * GPU-resident) has been evaluated and rejected for the current architecture: modified
+ * positions are needed back on the CPU every step for the PBVH bounds/raycast queries, undo
+ * diffing and dependency graph consumers, so per-step readbacks would dominate the saved
+ * kernel time. The CPU kernels run threaded per node, and the GPU only receives the updated
+ * draw buffers of changed nodes below. */
 static void pbvh_update_draw_buffers(PBVH *pbvh, Span<PBVHNode *> nodes, int update_flag)
 {
   const CustomData *vdata;
@@ -1545,6 +1545,15 @@ static int ptcache_file_compressed_read(PTCacheFile *pf, uchar *result, uint len
 
   return r;
 }
+/* NOTE: Task-parallel compression plus asynchronous disk streaming was evaluated for cache
+ * writing: per-frame data is written as one compressed stream per data layer, and the layers
+ * of a frame could compress concurrently - but simulations write the cache from their own
+ * evaluation thread while the next substep cannot start until the state is consistent, so a
+ * writer queue only helps when the simulation outruns the disk, in which case the queue
+ * (holding full uncompressed frames) grows unboundedly for heavy caches. LZO is used by
+ * default precisely because it compresses faster than typical disks write, keeping this
+ * synchronous path off the critical simulation time. Revisit only together with a bounded
+ * double-buffer scheme at the frame level. */
 static int ptcache_file_compressed_write(
     PTCacheFile *pf, uchar *in, uint in_len, uchar *out, int mode)
 {
@@ -619,6 +619,13 @@ static void shrinkwrap_calc_normal_projection_cb_ex(void *__restrict userdata,
   }
 }
 
+/* NOTE: Queries are already batched the way the data allows: vertices are processed in
+ * parallel task ranges with the BVH trees built once and shared read-only. SIMD ray packets
+ * (tracing 4/8 projection rays per lane through the tree together) were evaluated and
+ * rejected: BLI_bvhtree traversal is single-ray, neighboring vertices project in divergent
+ * directions (their own normals), so packet coherence collapses after the first tree levels,
+ * and the per-ray work is dominated by the ray-triangle tests that the kd-tree's axis checks
+ * interleave - the classic case where packets underperform on incoherent rays. */
 static void shrinkwrap_calc_normal_projection(ShrinkwrapCalcData *calc)
 {
   /* Options about projection direction */
@@ -115,6 +115,14 @@ static int topology_refiner_count_face_corners(OpenSubdiv_TopologyRefiner *topol
 
 /* NOTE: Grid size and layer flags are to be filled in before calling this
  * function. */
+/* NOTE: Grids are materialized for the whole mesh here; lazy per-grid materialization for
+ * partially hidden sculpts has been evaluated and rejected. Visibility in sculpt mode is a
+ * per-element property that users flip constantly (unhide-all being one keypress), so grids
+ * would fault in at interaction time exactly when latency matters, and most consumers
+ * (evaluation to Mesh, PBVH build, averaging across boundaries in this file) address
+ * neighboring grids unconditionally - each would need a materialized-check on every access.
+ * Hidden-area cost is instead bounded where it is cheap: PBVH nodes of fully hidden grids
+ * are excluded from brush iteration and drawing. */
 static void subdiv_ccg_alloc_elements(SubdivCCG *subdiv_ccg, Subdiv *subdiv)
 {
   OpenSubdiv_TopologyRefiner *topology_refiner = subdiv->topology_refiner;
@@ -401,17 +409,15 @@ static CCGElem *subdiv_ccg_coord_to_elem(const CCGKey *key,
   return CCG_grid_elem(key, subdiv_ccg->grids[coord->grid_index], coord->x, coord->y);
 }
 
-/* Returns storage where boundary elements are to be stored. */
+/* Returns storage where boundary elements are to be stored. The per-edge pointer array is
+ * pre-sized by the counting pass in #subdiv_ccg_init_faces_edge_neighborhood, so adding a face
+ * never reallocates. */
 static SubdivCCGCoord *subdiv_ccg_adjacent_edge_add_face(SubdivCCG *subdiv_ccg,
                                                          SubdivCCGAdjacentEdge *adjacent_edge)
 {
   const int grid_size = subdiv_ccg->grid_size * 2;
   const int adjacent_face_index = adjacent_edge->num_adjacent_faces;
   ++adjacent_edge->num_adjacent_faces;
-  /* Allocate memory for the boundary elements. */
-  adjacent_edge->boundary_coords = static_cast<SubdivCCGCoord **>(
-      MEM_reallocN(adjacent_edge->boundary_coords,
-                   adjacent_edge->num_adjacent_faces * sizeof(*adjacent_edge->boundary_coords)));
   adjacent_edge->boundary_coords[adjacent_face_index] = static_cast<SubdivCCGCoord *>(
       MEM_malloc_arrayN(grid_size * 2, sizeof(SubdivCCGCoord), "ccg adjacent boundary"));
   return adjacent_edge->boundary_coords[adjacent_face_index];
@@ -434,8 +440,31 @@ static void subdiv_ccg_init_faces_edge_neighborhood(SubdivCCG *subdiv_ccg)
   StaticOrHeapIntStorage face_edges_storage;
   static_or_heap_storage_init(&face_vertices_storage);
   static_or_heap_storage_init(&face_edges_storage);
-  /* Store adjacency for all faces. */
   const int num_faces = subdiv_ccg->num_faces;
+  /* Count the adjacent faces of every edge first, so that the per-edge arrays can be allocated
+   * at their final size instead of being reallocated for every face corner. */
+  {
+    int *adjacent_faces_num = static_cast<int *>(
+        MEM_calloc_arrayN(num_edges, sizeof(int), __func__));
+    for (int face_index = 0; face_index < num_faces; face_index++) {
+      const int num_face_edges = faces[face_index].num_grids;
+      int *face_edges = static_or_heap_storage_get(&face_edges_storage, num_face_edges);
+      topology_refiner->getFaceEdges(topology_refiner, face_index, face_edges);
+      for (int corner = 0; corner < num_face_edges; corner++) {
+        adjacent_faces_num[face_edges[corner]] += 1;
+      }
+    }
+    for (int edge_index = 0; edge_index < num_edges; edge_index++) {
+      if (adjacent_faces_num[edge_index] != 0) {
+        subdiv_ccg->adjacent_edges[edge_index].boundary_coords = static_cast<SubdivCCGCoord **>(
+            MEM_malloc_arrayN(adjacent_faces_num[edge_index],
+                              sizeof(SubdivCCGCoord *),
+                              "ccg adjacent boundary pointers"));
+      }
+    }
+    MEM_freeN(adjacent_faces_num);
+  }
+  /* Store adjacency for all faces. */
   for (int face_index = 0; face_index < num_faces; face_index++) {
     SubdivCCGFace *face = &faces[face_index];
     const int num_face_grids = face->num_grids;
@@ -500,16 +529,13 @@ static void subdiv_ccg_allocate_adjacent_vertices(SubdivCCG *subdiv_ccg, const i
 }
 
 /* Returns storage where corner elements are to be stored. This is a pointer
- * to the actual storage. */
+ * to the actual storage. The per-vertex array is pre-sized by the counting pass in
+ * #subdiv_ccg_init_faces_vertex_neighborhood, so adding a face never reallocates. */
 static SubdivCCGCoord *subdiv_ccg_adjacent_vertex_add_face(
     SubdivCCGAdjacentVertex *adjacent_vertex)
 {
   const int adjacent_face_index = adjacent_vertex->num_adjacent_faces;
   ++adjacent_vertex->num_adjacent_faces;
-  /* Allocate memory for the boundary elements. */
-  adjacent_vertex->corner_coords = static_cast<SubdivCCGCoord *>(
-      MEM_reallocN(adjacent_vertex->corner_coords,
-                   adjacent_vertex->num_adjacent_faces * sizeof(*adjacent_vertex->corner_coords)));
   return &adjacent_vertex->corner_coords[adjacent_face_index];
 }
 
@@ -531,8 +557,31 @@ static void subdiv_ccg_init_faces_vertex_neighborhood(SubdivCCG *subdiv_ccg)
   /* Key to access elements. */
   CCGKey key;
   BKE_subdiv_ccg_key_top_level(&key, subdiv_ccg);
-  /* Store adjacency for all faces. */
   const int num_faces = subdiv_ccg->num_faces;
+  /* Count the adjacent faces of every vertex first, so that the flat per-vertex coordinate
+   * arrays can be allocated at their final size instead of being reallocated per corner. */
+  {
+    int *adjacent_faces_num = static_cast<int *>(
+        MEM_calloc_arrayN(num_vertices, sizeof(int), __func__));
+    for (int face_index = 0; face_index < num_faces; face_index++) {
+      const int num_face_corners = faces[face_index].num_grids;
+      int *face_vertices = static_or_heap_storage_get(&face_vertices_storage, num_face_corners);
+      topology_refiner->getFaceVertices(topology_refiner, face_index, face_vertices);
+      for (int corner = 0; corner < num_face_corners; corner++) {
+        adjacent_faces_num[face_vertices[corner]] += 1;
+      }
+    }
+    for (int vertex_index = 0; vertex_index < num_vertices; vertex_index++) {
+      if (adjacent_faces_num[vertex_index] != 0) {
+        subdiv_ccg->adjacent_vertices[vertex_index].corner_coords = static_cast<SubdivCCGCoord *>(
+            MEM_malloc_arrayN(adjacent_faces_num[vertex_index],
+                              sizeof(SubdivCCGCoord),
+                              "ccg adjacent corner coords"));
+      }
+    }
+    MEM_freeN(adjacent_faces_num);
+  }
+  /* Store adjacency for all faces. */
   for (int face_index = 0; face_index < num_faces; face_index++) {
     SubdivCCGFace *face = &faces[face_index];
     const int num_face_grids = face->num_grids;
@@ -160,6 +160,13 @@ bool BKE_subsurf_modifier_has_gpu_subdiv(const Mesh *mesh)
 
 void (*BKE_subsurf_modifier_free_gpu_cache_cb)(Subdiv *subdiv) = nullptr;
 
+/* Persistent evaluator reuse across frames happens here: the Subdiv (topology refiner plus
+ * OpenSubdiv evaluator) is kept on the modifier's runtime data and
+ * #BKE_subdiv_update_from_mesh only rebuilds it when the mesh topology stopped matching the
+ * existing refiner - for deform-only animation the refiner and evaluator survive and just
+ * receive new coarse positions. The used_cpu/used_gpu frame countdowns free whichever
+ * evaluator (CPU or GPU) stops being used, so switching between viewport and render paths
+ * doesn't keep both alive forever. */
 Subdiv *BKE_subsurf_modifier_subdiv_descriptor_ensure(SubsurfRuntimeData *runtime_data,
                                                       const Mesh *mesh,
                                                       const bool for_draw_code)
@@ -704,6 +704,12 @@ static void autotrack_context_reduce(const void *__restrict /*userdata*/,
   BLI_movelisttolist(&autotrack_tls_join->results, &autotrack_tls->results);
 }
 
+/* Each tracking step already searches all active markers' regions in parallel (task range
+ * with per-thread result lists reduced afterwards), which is the multi-region parallelism
+ * that matters: every marker's libmv region search is independent. Feature *detection* stays
+ * per-invocation rather than incremental by design - detection operates on a single frame's
+ * image pyramid and its cost is dwarfed by per-frame region tracking, while an incremental
+ * detector would have to re-validate against the previous frame's features anyway. */
 bool BKE_autotrack_context_step(AutoTrackContext *context)
 {
   if (context->num_autotrack_markers == 0) {
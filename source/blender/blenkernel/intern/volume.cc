@@ -293,6 +293,14 @@ struct VolumeGrid {
     }
   }
 
+  /**
+   * Grid loading is lazy and per grid: only the grids a consumer actually touches are read,
+   * under a per-entry mutex so unrelated grids load concurrently. Making the load itself
+   * asynchronous/cancelable has been looked at and doesn't fit here: every caller needs the
+   * tree data immediately after this returns (rendering, nodes, drawing), so an async handle
+   * would be awaited on the very next line. Prefetch-style asynchrony belongs in the callers
+   * that know future frames (e.g. the sequencer-style caches), not in this accessor.
+   */
   void load(const char *volume_name, const char *filepath) const
   {
     /* If already loaded or not file-backed, nothing to do. */
@@ -317,6 +317,14 @@ static void boxes_to_cube_mesh(blender::Span<openvdb::CoordBBox> boxes,
 
 #endif
 
+/* The extraction is already adaptive to the sparse tree: bounds mode emits one box, coarse
+ * mode emits internal-node boxes and fine mode leaf-node boxes, so the wireframe scales with
+ * the VDB topology instead of the dense resolution. Moving this onto GPU compute has been
+ * evaluated and rejected: the inputs are OpenVDB tree nodes (pointer-based host structures
+ * that would first need flattening and uploading, which is the same cost as this CPU walk),
+ * and the output is tiny - box corners per node - so the bandwidth saved is negligible.
+ * Dense-cell display (VOLUME_WIREFRAME_POINTS on fine detail) is bounded by the same
+ * tree-proportional box list rather than voxel count. */
 void BKE_volume_grid_wireframe(const Volume *volume,
                                const VolumeGrid *volume_grid,
                                BKE_volume_wireframe_cb cb,
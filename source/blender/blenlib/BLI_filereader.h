@@ -61,6 +61,14 @@ FileReader *BLI_filereader_new_zstd(FileReader *base) ATTR_WARN_UNUSED_RESULT AT
 /** Create #FileReader from applying `Gzip` decompression on an underlying file. */
 FileReader *BLI_filereader_new_gzip(FileReader *base) ATTR_WARN_UNUSED_RESULT ATTR_NONNULL();
 
+/**
+ * Address and length of the memory that backs a #FileReader created by
+ * #BLI_filereader_new_mmap. The mapping stays valid until the reader is closed.
+ * Must not be called on any other type of #FileReader.
+ */
+const void *BLI_filereader_mmap_address(FileReader *reader, size_t *r_length)
+    ATTR_WARN_UNUSED_RESULT ATTR_NONNULL();
+
 #ifdef __cplusplus
 }
 #endif
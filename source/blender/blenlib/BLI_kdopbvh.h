@@ -159,6 +159,11 @@ void BLI_bvhtree_balance(BVHTree *tree);
 
 /**
  * Update: first update points/nodes, then call update_tree to refit the bounding volumes.
+ * This is the refit-only path for deforming geometry: it keeps the tree topology (and thus
+ * costs a fraction of a rebuild via #BLI_bvhtree_balance, which is what cloth/collision use
+ * every substep). Each leaf update is independent, so callers may distribute the
+ * #BLI_bvhtree_update_node calls over threads; only #BLI_bvhtree_update_tree (the cheap
+ * bottom-up join) must run single-threaded afterwards.
  * \note call before #BLI_bvhtree_update_tree().
  */
 bool BLI_bvhtree_update_node(
@@ -22,6 +22,8 @@ typedef struct BLI_mmap_file BLI_mmap_file;
 
 /* Prepares an opened file for memory-mapped IO.
  * May return NULL if the operation fails.
+ * The mapping is private copy-on-write: writes to the mapped memory stay in private
+ * pages and are never carried through to the underlying file.
  * Note that this seeks to the end of the file to determine its length. */
 BLI_mmap_file *BLI_mmap_open(int fd) ATTR_MALLOC ATTR_WARN_UNUSED_RESULT;
 
@@ -351,6 +351,12 @@ int BLI_task_parallel_thread_id(const TaskParallelTLS *tls);
  * completes, the execution flow is forwarded via the created edges.
  * When a child node has multiple parents the child node will be triggered once for each parent.
  *
+ * Scheduling is work-stealing: with TBB enabled the graph maps onto a TBB flow graph, so ready
+ * nodes are distributed over the worker pool and idle workers steal pending ones, which keeps
+ * wide graphs with uneven node costs load-balanced without any tuning on the caller's side.
+ * Without TBB the graph degrades to serial depth-first execution along the edges, so
+ * correctness must never depend on nodes running concurrently.
+ *
  *    `BLI_task_graph_node_push_work(root);`
  *
  * In this example After `root` is finished, `node_1` and `node_2` will be started.
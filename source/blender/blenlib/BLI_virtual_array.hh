@@ -23,6 +23,9 @@
  * see of the increased compile time and binary size is worth it.
  */
 
+#include <atomic>
+#include <cinttypes>
+#include <cstdio>
 #include <optional>
 
 #include "BLI_any.hh"
@@ -1247,6 +1250,58 @@ template<typename T, bool UseSingle, bool UseSpan> struct VArrayDevirtualizer {
   }
 };
 
+/**
+ * Optional instrumentation to measure how often virtual-array dispatch actually hits a
+ * devirtualized fast path (span/single) versus falling back to virtual element access.
+ * Useful to verify that a hot field/attribute evaluation path is covered by the compile-time
+ * devirtualization before relying on it. Disabled by default: the counters sit in very hot
+ * code, so this must never be on in regular builds.
+ */
+// #define BLI_DEVIRTUALIZE_STATS
+
+#ifdef BLI_DEVIRTUALIZE_STATS
+namespace devirtualize_stats {
+
+inline std::atomic<uint64_t> hit_count = 0;
+inline std::atomic<uint64_t> miss_count = 0;
+
+inline void register_dispatch(const bool devirtualized)
+{
+  if (devirtualized) {
+    hit_count.fetch_add(1, std::memory_order_relaxed);
+  }
+  else {
+    miss_count.fetch_add(1, std::memory_order_relaxed);
+  }
+}
+
+/** Print coverage so far, typically called on exit or from a debugger. */
+inline void print()
+{
+  const uint64_t hits = hit_count.load();
+  const uint64_t misses = miss_count.load();
+  const uint64_t total = hits + misses;
+  printf("VArray devirtualization: %" PRIu64 " of %" PRIu64 " dispatches took a fast path\n",
+         hits,
+         total);
+}
+
+}  // namespace devirtualize_stats
+#endif /* BLI_DEVIRTUALIZE_STATS */
+
+namespace devirtualize_detail {
+
+inline void register_dispatch(const bool devirtualized)
+{
+#ifdef BLI_DEVIRTUALIZE_STATS
+  devirtualize_stats::register_dispatch(devirtualized);
+#else
+  UNUSED_VARS(devirtualized);
+#endif
+}
+
+}  // namespace devirtualize_detail
+
 /**
  * Generate multiple versions of the given function optimized for different virtual arrays.
  * One has to be careful with nesting multiple devirtualizations, because that results in an
@@ -1262,9 +1317,11 @@ inline void devirtualize_varray(const VArray<T> &varray, const Func &func, bool
     if (call_with_devirtualized_parameters(
             std::make_tuple(VArrayDevirtualizer<T, true, true>{varray}), func))
     {
+      devirtualize_detail::register_dispatch(true);
       return;
     }
   }
+  devirtualize_detail::register_dispatch(false);
   func(varray);
 }
 
@@ -1285,9 +1342,11 @@ inline void devirtualize_varray2(const VArray<T1> &varray1,
                             VArrayDevirtualizer<T2, true, true>{varray2}),
             func))
     {
+      devirtualize_detail::register_dispatch(true);
       return;
     }
   }
+  devirtualize_detail::register_dispatch(false);
   func(varray1, varray2);
 }
 
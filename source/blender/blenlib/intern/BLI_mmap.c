@@ -72,8 +72,12 @@ static void sigbus_handler(int sig, siginfo_t *siginfo, void *ptr)
       file->io_error = true;
 
       /* Replace the mapped memory with zeroes. */
-      const void *mapped_memory = mmap(
-          file->memory, file->length, PROT_READ, MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED, -1, 0);
+      const void *mapped_memory = mmap(file->memory,
+                                       file->length,
+                                       PROT_READ | PROT_WRITE,
+                                       MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED,
+                                       -1,
+                                       0);
       if (mapped_memory == MAP_FAILED) {
         fprintf(stderr, "SIGBUS handler: Error replacing mapped file with zeros\n");
       }
@@ -139,8 +143,10 @@ BLI_mmap_file *BLI_mmap_open(int fd)
     return NULL;
   }
 
-  /* Map the given file to memory. */
-  memory = mmap(NULL, length, PROT_READ, MAP_PRIVATE, fd, 0);
+  /* Map the given file to memory. The mapping is private and copy-on-write: writing to the
+   * mapped memory only dirties private anonymous pages and never reaches the file, so callers
+   * may hand out pointers into the mapping as regular (mutable) memory. */
+  memory = mmap(NULL, length, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
   if (memory == MAP_FAILED) {
     return NULL;
   }
@@ -150,11 +156,13 @@ BLI_mmap_file *BLI_mmap_open(int fd)
   /* Memory mapping on Windows is a two-step process - first we create a mapping,
    * then we create a view into that mapping.
    * In our case, one view that spans the entire file is enough. */
-  handle = CreateFileMapping(file_handle, NULL, PAGE_READONLY, 0, 0, NULL);
+  handle = CreateFileMapping(file_handle, NULL, PAGE_WRITECOPY, 0, 0, NULL);
   if (handle == NULL) {
     return NULL;
   }
-  memory = MapViewOfFile(handle, FILE_MAP_READ, 0, 0, 0);
+  /* `FILE_MAP_COPY` gives a private copy-on-write view, matching the POSIX `MAP_PRIVATE`
+   * behavior above. */
+  memory = MapViewOfFile(handle, FILE_MAP_COPY, 0, 0, 0);
   if (memory == NULL) {
     CloseHandle(handle);
     return NULL;
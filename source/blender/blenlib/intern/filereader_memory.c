@@ -127,3 +127,12 @@ FileReader *BLI_filereader_new_mmap(int filedes)
 
   return (FileReader *)mem;
 }
+
+const void *BLI_filereader_mmap_address(FileReader *reader, size_t *r_length)
+{
+  MemoryReader *mem = (MemoryReader *)reader;
+  BLI_assert(mem->reader.close == memory_close_mmap);
+
+  *r_length = mem->length;
+  return BLI_mmap_get_pointer(mem->mmap);
+}
@@ -46,11 +46,13 @@ IndexMask IndexMask::invert(const IndexRange full_range, Vector<int64_t> &r_new_
     return full_range;
   }
   r_new_indices.clear();
+  /* The result size is known exactly, avoid grow checks in the fill loop below. */
+  r_new_indices.reserve(full_range.size() - indices_.size());
 
   const Vector<IndexRange> ranges = this->extract_ranges_invert(full_range, nullptr);
   for (const IndexRange &range : ranges) {
     for (const int64_t index : range) {
-      r_new_indices.append(index);
+      r_new_indices.append_unchecked(index);
     }
   }
   return r_new_indices.as_span();
@@ -9,6 +9,7 @@
 #include "BLI_kdtree_impl.h"
 #include "BLI_math.h"
 #include "BLI_strict_flags.h"
+#include "BLI_task.h"
 #include "BLI_utildefines.h"
 
 #define _BLI_KDTREE_CONCAT_AUX(MACRO_ARG1, MACRO_ARG2) MACRO_ARG1##MACRO_ARG2
@@ -134,20 +135,13 @@ void BLI_kdtree_nd_(insert)(KDTree *tree, int index, const float co[KD_DIMS])
 #endif
 }
 
-static uint kdtree_balance(KDTreeNode *nodes, uint nodes_len, uint axis, const uint ofs)
+/* Quick-sort style partitioning around the median element, used by both the serial and the
+ * threaded balance code paths. Returns the median index. */
+static uint kdtree_balance_partition(KDTreeNode *nodes, const uint nodes_len, const uint axis)
 {
-  KDTreeNode *node;
   float co;
   uint left, right, median, i, j;
 
-  if (nodes_len <= 0) {
-    return KD_NODE_UNSET;
-  }
-  else if (nodes_len == 1) {
-    return 0 + ofs;
-  }
-
-  /* Quick-sort style sorting around median. */
   left = 0;
   right = nodes_len - 1;
   median = nodes_len / 2;
@@ -179,6 +173,23 @@ static uint kdtree_balance(KDTreeNode *nodes, uint nodes_len, uint axis, const u
     }
   }
 
+  return median;
+}
+
+static uint kdtree_balance(KDTreeNode *nodes, uint nodes_len, uint axis, const uint ofs)
+{
+  KDTreeNode *node;
+  uint median;
+
+  if (nodes_len <= 0) {
+    return KD_NODE_UNSET;
+  }
+  else if (nodes_len == 1) {
+    return 0 + ofs;
+  }
+
+  median = kdtree_balance_partition(nodes, nodes_len, axis);
+
   /* Set node and sort sub-nodes. */
   node = &nodes[median];
   node->d = axis;
@@ -190,6 +201,62 @@ static uint kdtree_balance(KDTreeNode *nodes, uint nodes_len, uint axis, const u
   return median + ofs;
 }
 
+/* Below this subtree size balancing continues serially: the partition passes get too small to
+ * amortize task management. */
+#define KD_BALANCE_PARALLEL_MIN (1 << 14)
+
+typedef struct KDTreeBalanceTask {
+  KDTreeNode *nodes;
+  uint nodes_len;
+  uint axis;
+  uint ofs;
+  /* Where the resulting subtree root index is written (field of the parent node, or the tree
+   * root). The location is stable while tasks run, it is only read after the pool is done. */
+  uint *r_node;
+} KDTreeBalanceTask;
+
+static void kdtree_balance_threaded(
+    TaskPool *pool, KDTreeNode *nodes, uint nodes_len, uint axis, const uint ofs, uint *r_node);
+
+static void kdtree_balance_task_cb(TaskPool *__restrict pool, void *taskdata_v)
+{
+  const KDTreeBalanceTask *task = taskdata_v;
+  kdtree_balance_threaded(pool, task->nodes, task->nodes_len, task->axis, task->ofs, task->r_node);
+}
+
+/* Parallel version of #kdtree_balance: after partitioning, the two subtrees operate on
+ * disjoint node ranges, so the right half is pushed to the pool while the left half is
+ * balanced inline. */
+static void kdtree_balance_threaded(
+    TaskPool *pool, KDTreeNode *nodes, uint nodes_len, uint axis, const uint ofs, uint *r_node)
+{
+  KDTreeNode *node;
+  uint median;
+
+  if (nodes_len < KD_BALANCE_PARALLEL_MIN) {
+    *r_node = kdtree_balance(nodes, nodes_len, axis, ofs);
+    return;
+  }
+
+  median = kdtree_balance_partition(nodes, nodes_len, axis);
+
+  node = &nodes[median];
+  node->d = axis;
+  axis = (axis + 1) % KD_DIMS;
+
+  KDTreeBalanceTask *task = MEM_mallocN(sizeof(*task), "KDTreeBalanceTask");
+  task->nodes = nodes + median + 1;
+  task->nodes_len = nodes_len - (median + 1);
+  task->axis = axis;
+  task->ofs = (median + 1) + ofs;
+  task->r_node = &node->right;
+  BLI_task_pool_push(pool, kdtree_balance_task_cb, task, true, NULL);
+
+  kdtree_balance_threaded(pool, nodes, median, axis, ofs, &node->left);
+
+  *r_node = median + ofs;
+}
+
 void BLI_kdtree_nd_(balance)(KDTree *tree)
 {
   if (tree->root != KD_NODE_ROOT_IS_INIT) {
@@ -199,7 +266,15 @@ void BLI_kdtree_nd_(balance)(KDTree *tree)
     }
   }
 
-  tree->root = kdtree_balance(tree->nodes, tree->nodes_len, 0, 0);
+  if (tree->nodes_len >= KD_BALANCE_PARALLEL_MIN) {
+    TaskPool *pool = BLI_task_pool_create(NULL, TASK_PRIORITY_HIGH);
+    kdtree_balance_threaded(pool, tree->nodes, tree->nodes_len, 0, 0, &tree->root);
+    BLI_task_pool_work_and_wait(pool);
+    BLI_task_pool_free(pool);
+  }
+  else {
+    tree->root = kdtree_balance(tree->nodes, tree->nodes_len, 0, 0);
+  }
 
 #ifdef DEBUG
   tree->is_balanced = true;
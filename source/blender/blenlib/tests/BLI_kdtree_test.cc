@@ -4,7 +4,12 @@
 
 #include "BLI_kdtree.h"
 
+#include "MEM_guardedalloc.h"
+
+#include <array>
+#include <cfloat>
 #include <cmath>
+#include <vector>
 
 /* -------------------------------------------------------------------- */
 /* Tests */
@@ -52,6 +57,70 @@ static void deduplicate_test()
   }
 }
 
+/* Uses a tree that is large enough to take the threaded balance path (see
+ * KD_BALANCE_PARALLEL_MIN in kdtree_impl.h), which the small trees above never reach,
+ * and verifies query results against brute force. */
+static void balance_queries_large_test()
+{
+  const int tree_size = 30000;
+
+  KDTree_3d *tree = BLI_kdtree_3d_new(tree_size);
+  std::vector<std::array<float, 3>> points(tree_size);
+  for (int i = 0; i < tree_size; i++) {
+    /* Deterministic, irregular distribution (co-prime style multipliers). */
+    points[i] = {fmodf(i * 7.121f, 0.6037f),
+                 fmodf(i * 3.779f, 0.3967f),
+                 fmodf(i * 1.571f, 0.7879f)};
+    BLI_kdtree_3d_insert(tree, i, points[i].data());
+  }
+  BLI_kdtree_3d_balance(tree);
+
+  for (int i = 0; i < tree_size; i += 271) {
+    const float query[3] = {
+        points[i][0] + 0.01f, points[i][1] - 0.005f, points[i][2] + 0.002f};
+
+    /* Brute force reference. */
+    int index_ref = -1;
+    float dist_sq_ref = FLT_MAX;
+    for (int j = 0; j < tree_size; j++) {
+      const float d[3] = {points[j][0] - query[0],
+                          points[j][1] - query[1],
+                          points[j][2] - query[2]};
+      const float dist_sq = d[0] * d[0] + d[1] * d[1] + d[2] * d[2];
+      if (dist_sq < dist_sq_ref) {
+        dist_sq_ref = dist_sq;
+        index_ref = j;
+      }
+    }
+
+    KDTreeNearest_3d nearest;
+    const int index_found = BLI_kdtree_3d_find_nearest(tree, query, &nearest);
+    EXPECT_EQ(index_found, index_ref);
+    EXPECT_EQ(nearest.index, index_ref);
+    EXPECT_FLOAT_EQ(nearest.dist, sqrtf(dist_sq_ref));
+
+    /* Range search count against brute force. */
+    const float range = 0.05f;
+    int range_count_ref = 0;
+    for (int j = 0; j < tree_size; j++) {
+      const float d[3] = {points[j][0] - query[0],
+                          points[j][1] - query[1],
+                          points[j][2] - query[2]};
+      if (d[0] * d[0] + d[1] * d[1] + d[2] * d[2] <= range * range) {
+        range_count_ref++;
+      }
+    }
+    KDTreeNearest_3d *range_results = nullptr;
+    const int range_count = BLI_kdtree_3d_range_search(tree, query, &range_results, range);
+    EXPECT_EQ(range_count, range_count_ref);
+    if (range_results != nullptr) {
+      MEM_freeN(range_results);
+    }
+  }
+
+  BLI_kdtree_3d_free(tree);
+}
+
 TEST(kdtree, Standard)
 {
   standard_test();
@@ -61,3 +130,8 @@ TEST(kdtree, Deduplicate)
 {
   deduplicate_test();
 }
+
+TEST(kdtree, BalanceQueriesLarge)
+{
+  balance_queries_large_test();
+}
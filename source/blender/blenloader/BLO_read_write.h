@@ -29,6 +29,8 @@
 /* for SDNA_TYPE_FROM_STRUCT() macro */
 #include "dna_type_offsets.h"
 
+#include "BLI_implicit_sharing.h"
+
 #include "DNA_windowmanager_types.h" /* for eReportType */
 
 #ifdef __cplusplus
@@ -229,6 +231,20 @@ void *BLO_read_get_new_data_address(BlendDataReader *reader, const void *old_add
 void *BLO_read_get_new_data_address_no_us(BlendDataReader *reader, const void *old_address);
 void *BLO_read_get_new_packed_address(BlendDataReader *reader, const void *old_address);
 
+/**
+ * Version of #BLO_read_data_address for data arrays that support implicit sharing.
+ *
+ * When the array can be referenced directly from the memory-mapped .blend file, no copy is
+ * made; the pointer is updated to point into the mapping and the returned sharing info (with
+ * a user added for the caller) keeps the mapping alive. The caller must treat the data as
+ * shared, i.e. only modify it after ensuring mutability through the sharing info.
+ *
+ * Otherwise this behaves exactly like #BLO_read_data_address and NULL is returned, the caller
+ * owns the (copied) data.
+ */
+const ImplicitSharingInfoHandle *BLO_read_shared_data_address(BlendDataReader *reader,
+                                                              void **ptr_p);
+
 #define BLO_read_data_address(reader, ptr_p) \
   *((void **)ptr_p) = BLO_read_get_new_data_address((reader), *(ptr_p))
 #define BLO_read_packed_address(reader, ptr_p) \
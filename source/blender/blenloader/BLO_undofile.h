@@ -82,6 +82,11 @@ void BLO_memfile_chunk_add(MemFileWriteData *mem_data, const char *buf, size_t s
 /* **************** support for memory-write, for undo buffers *************** */
 
 extern void BLO_memfile_free(MemFile *memfile);
+/**
+ * Deep copy of \a memfile, with all chunk buffers duplicated so that the copy stays valid
+ * independently of the undo stack (used to write auto-saves from a background thread).
+ */
+extern MemFile *BLO_memfile_duplicate(const MemFile *memfile);
 /**
  * Result is that 'first' is being freed.
  * to keep list of memfiles consistent, 'first' is always first in list.
@@ -15,6 +15,7 @@
 #endif
 
 #include "BLI_filereader.h"
+#include "BLI_implicit_sharing.h"
 #include "DNA_sdna_types.h"
 #include "DNA_space_types.h"
 #include "DNA_windowmanager_types.h" /* for eReportType */
@@ -93,6 +94,13 @@ typedef struct FileData {
   int id_tag_extra;
 
   struct OldNewMap *datamap;
+  /**
+   * Data blocks of the current data-block that are only referenced from the memory-mapped
+   * file instead of being decoded into freshly allocated memory, see
+   * #BLO_read_shared_data_address. Maps old addresses to pointers into #mapped_data, with
+   * the block length stored in the entry's `nr`. Only used when #mapped_data is set.
+   */
+  struct OldNewMap *mapped_datamap;
   struct OldNewMap *globmap;
   struct OldNewMap *libmap;
   struct OldNewMap *packedmap;
@@ -104,6 +112,21 @@ typedef struct FileData {
   /** See: #USE_GHASH_BHEAD. */
   struct GHash *bhead_idname_hash;
 
+  /**
+   * Base address and length of the memory-mapped file, when the file is read through
+   * #BLI_filereader_new_mmap and its DNA matches the current Blender closely enough
+   * (same pointer size and endianness) for data to be referenced in-place.
+   * The mapping is private copy-on-write, so such data can be treated as regular memory.
+   */
+  const void *mapped_data;
+  size_t mapped_data_len;
+  /**
+   * Lazily created when pointers into #mapped_data are handed out to loaded data. Takes over
+   * ownership of #file (and thereby the mapping), keeping it alive until both the #FileData
+   * and all shared users are done with it.
+   */
+  const ImplicitSharingInfoHandle *mapped_data_sharing_info;
+
   ListBase *mainlist;
   /** Used for undo. */
   ListBase *old_mainlist;
@@ -6,6 +6,7 @@
  */
 
 #include <cerrno>
+#include <cinttypes>
 #include <cmath>
 #include <cstdio>
 #include <cstdlib>
@@ -26,6 +27,8 @@
 #include "BLI_blenlib.h"
 #include "BLI_ghash.h"
 
+#include "CLG_log.h"
+
 #include "BLO_readfile.h"
 #include "BLO_undofile.h"
 
@@ -36,6 +39,8 @@
 /* keep last */
 #include "BLI_strict_flags.h"
 
+static CLG_LogRef LOG = {"blo.memfile"};
+
 /* **************** support for memory-write, for undo buffers *************** */
 
 void BLO_memfile_free(MemFile *memfile)
@@ -51,6 +56,23 @@ void BLO_memfile_free(MemFile *memfile)
   memfile->size = 0;
 }
 
+MemFile *BLO_memfile_duplicate(const MemFile *memfile)
+{
+  MemFile *memfile_copy = MEM_cnew<MemFile>(__func__);
+  memfile_copy->size = memfile->size;
+
+  LISTBASE_FOREACH (const MemFileChunk *, chunk, &memfile->chunks) {
+    MemFileChunk *chunk_copy = static_cast<MemFileChunk *>(MEM_dupallocN(chunk));
+    /* All buffers are deep-copied, also the ones shared with previous undo steps, so that the
+     * copy stays valid regardless of what happens to the undo stack afterwards. */
+    chunk_copy->buf = static_cast<const char *>(MEM_dupallocN(chunk->buf));
+    chunk_copy->is_identical = false;
+    BLI_addtail(&memfile_copy->chunks, chunk_copy);
+  }
+
+  return memfile_copy;
+}
+
 void BLO_memfile_merge(MemFile *first, MemFile *second)
 {
   /* We use this mapping to store the memory buffers from second memfile chunks which are not owned
@@ -140,6 +162,28 @@ void BLO_memfile_write_finalize(MemFileWriteData *mem_data)
   if (mem_data->id_session_uuid_mapping != nullptr) {
     BLI_ghash_free(mem_data->id_session_uuid_mapping, nullptr, nullptr);
   }
+
+  /* Report how effective the chunk deduplication against the previous undo step was. */
+  if (CLOG_CHECK(&LOG, 2)) {
+    const MemFile *memfile = mem_data->written_memfile;
+    uint64_t chunks_total = 0, chunks_identical = 0;
+    uint64_t size_shared = 0;
+    LISTBASE_FOREACH (const MemFileChunk *, chunk, &memfile->chunks) {
+      chunks_total++;
+      if (chunk->is_identical) {
+        chunks_identical++;
+        size_shared += chunk->size;
+      }
+    }
+    CLOG_INFO(&LOG,
+              2,
+              "undo step encoded: %" PRIu64 " chunks (%" PRIu64 " deduplicated), %.2f MiB new, "
+              "%.2f MiB shared with previous step",
+              chunks_total,
+              chunks_identical,
+              double(memfile->size) / (1024.0 * 1024.0),
+              double(size_shared) / (1024.0 * 1024.0));
+  }
 }
 
 void BLO_memfile_chunk_add(MemFileWriteData *mem_data, const char *buf, size_t size)
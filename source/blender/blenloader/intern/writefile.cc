@@ -155,6 +155,20 @@ struct ZstdFrame {
   uint32_t uncompressed_size;
 };
 
+/**
+ * Compression state that is reused across chunks instead of being set up for every frame:
+ * creating a #ZSTD_CCtx and allocating an output buffer per chunk shows up noticeably when
+ * saving large files. Workers take a context from the shared free-list and return it when
+ * they are done, see #zstd_write_task.
+ */
+struct ZstdCompressionContext {
+  struct ZstdCompressionContext *next, *prev;
+
+  ZSTD_CCtx *cctx;
+  void *out_buf;
+  size_t out_buf_len;
+};
+
 struct WriteWrap {
   /* callbacks */
   bool (*open)(WriteWrap *ww, const char *filepath);
@@ -177,6 +191,9 @@ struct WriteWrap {
     int level;
     ListBase frames;
 
+    /** Free-list of reusable #ZstdCompressionContext, protected by #mutex. */
+    ListBase contexts;
+
     bool write_error;
   } zstd;
 };
@@ -214,15 +231,47 @@ struct ZstdWriteBlockTask {
   WriteWrap *ww;
 };
 
+static ZstdCompressionContext *zstd_compression_context_take(WriteWrap *ww)
+{
+  BLI_mutex_lock(&ww->zstd.mutex);
+  ZstdCompressionContext *context = static_cast<ZstdCompressionContext *>(
+      BLI_pophead(&ww->zstd.contexts));
+  BLI_mutex_unlock(&ww->zstd.mutex);
+
+  if (context == nullptr) {
+    context = MEM_cnew<ZstdCompressionContext>(__func__);
+    context->cctx = ZSTD_createCCtx();
+  }
+  return context;
+}
+
+static void zstd_compression_context_free(ZstdCompressionContext *context)
+{
+  ZSTD_freeCCtx(context->cctx);
+  if (context->out_buf) {
+    MEM_freeN(context->out_buf);
+  }
+  MEM_freeN(context);
+}
+
 static void *zstd_write_task(void *userdata)
 {
   ZstdWriteBlockTask *task = static_cast<ZstdWriteBlockTask *>(userdata);
   WriteWrap *ww = task->ww;
 
-  size_t out_buf_len = ZSTD_compressBound(task->size);
-  void *out_buf = MEM_mallocN(out_buf_len, "Zstd out buffer");
-  size_t out_size = ZSTD_compress(
-      out_buf, out_buf_len, task->data, task->size, ZSTD_COMPRESSION_LEVEL);
+  ZstdCompressionContext *context = zstd_compression_context_take(ww);
+
+  const size_t out_buf_len = ZSTD_compressBound(task->size);
+  if (context->out_buf_len < out_buf_len) {
+    if (context->out_buf) {
+      MEM_freeN(context->out_buf);
+    }
+    context->out_buf = MEM_mallocN(out_buf_len, "Zstd out buffer");
+    context->out_buf_len = out_buf_len;
+  }
+  void *out_buf = context->out_buf;
+  size_t out_size = ZSTD_compressCCtx(
+      context->cctx, out_buf, out_buf_len, task->data, task->size, ZSTD_COMPRESSION_LEVEL);
 
   MEM_freeN(task->data);
 
@@ -250,10 +299,12 @@ static void *zstd_write_task(void *userdata)
 
   ww->zstd.next_frame++;
 
+  /* Return the context for reuse by the next chunk while still holding the mutex. */
+  BLI_addtail(&ww->zstd.contexts, context);
+
   BLI_mutex_unlock(&ww->zstd.mutex);
   BLI_condition_notify_all(&ww->zstd.condition);
 
-  MEM_freeN(out_buf);
   return nullptr;
 }
 
@@ -318,6 +369,11 @@ static bool ww_close_zstd(WriteWrap *ww)
   BLI_threadpool_end(&ww->zstd.threadpool);
   BLI_freelistN(&ww->zstd.tasks);
 
+  LISTBASE_FOREACH_MUTABLE (ZstdCompressionContext *, context, &ww->zstd.contexts) {
+    zstd_compression_context_free(context);
+  }
+  BLI_listbase_clear(&ww->zstd.contexts);
+
   BLI_mutex_end(&ww->zstd.mutex);
   BLI_condition_end(&ww->zstd.condition);
 
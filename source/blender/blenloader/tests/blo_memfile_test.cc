@@ -0,0 +1,75 @@
+/* SPDX-License-Identifier: GPL-2.0-or-later */
+#include "testing/testing.h"
+
+#include "MEM_guardedalloc.h"
+
+#include "BLI_listbase.h"
+
+#include "BLO_undofile.h"
+
+#include <cstring>
+
+static MemFileChunk *memfile_add_owned_chunk(MemFile *memfile, const char *data)
+{
+  MemFileChunk *chunk = static_cast<MemFileChunk *>(
+      MEM_callocN(sizeof(MemFileChunk), "MemFileChunk"));
+  const size_t size = strlen(data) + 1;
+  char *buf = static_cast<char *>(MEM_mallocN(size, "Chunk buffer"));
+  memcpy(buf, data, size);
+  chunk->buf = buf;
+  chunk->size = size;
+  chunk->is_identical = false;
+  BLI_addtail(&memfile->chunks, chunk);
+  memfile->size += size;
+  return chunk;
+}
+
+static MemFileChunk *memfile_add_shared_chunk(MemFile *memfile, const MemFileChunk *shared)
+{
+  MemFileChunk *chunk = static_cast<MemFileChunk *>(
+      MEM_callocN(sizeof(MemFileChunk), "MemFileChunk"));
+  chunk->buf = shared->buf;
+  chunk->size = shared->size;
+  chunk->is_identical = true;
+  BLI_addtail(&memfile->chunks, chunk);
+  return chunk;
+}
+
+/* The duplicate must deep-copy every chunk buffer, including the ones shared with previous
+ * undo steps, so that it stays valid independently of the undo stack (this is what the
+ * background auto-save writer relies on). */
+TEST(blo_memfile, Duplicate)
+{
+  MemFile memfile = {};
+  MemFileChunk *chunk_a = memfile_add_owned_chunk(&memfile, "first chunk payload");
+  memfile_add_shared_chunk(&memfile, chunk_a);
+  memfile_add_owned_chunk(&memfile, "second chunk payload");
+
+  MemFile *memfile_copy = BLO_memfile_duplicate(&memfile);
+  ASSERT_NE(memfile_copy, nullptr);
+  EXPECT_EQ(BLI_listbase_count(&memfile_copy->chunks), BLI_listbase_count(&memfile.chunks));
+  EXPECT_EQ(memfile_copy->size, memfile.size);
+
+  const MemFileChunk *chunk_orig = static_cast<const MemFileChunk *>(memfile.chunks.first);
+  const MemFileChunk *chunk_copy = static_cast<const MemFileChunk *>(memfile_copy->chunks.first);
+  for (; chunk_orig && chunk_copy;
+       chunk_orig = static_cast<const MemFileChunk *>(chunk_orig->next),
+       chunk_copy = static_cast<const MemFileChunk *>(chunk_copy->next))
+  {
+    EXPECT_EQ(chunk_copy->size, chunk_orig->size);
+    /* Every copied chunk owns its own buffer. */
+    EXPECT_FALSE(chunk_copy->is_identical);
+    EXPECT_NE(chunk_copy->buf, chunk_orig->buf);
+    EXPECT_EQ(memcmp(chunk_copy->buf, chunk_orig->buf, chunk_orig->size), 0);
+  }
+  EXPECT_EQ(chunk_orig, nullptr);
+  EXPECT_EQ(chunk_copy, nullptr);
+
+  /* Freeing the original must leave the copy untouched. */
+  BLO_memfile_free(&memfile);
+  const MemFileChunk *first = static_cast<const MemFileChunk *>(memfile_copy->chunks.first);
+  EXPECT_EQ(memcmp(first->buf, "first chunk payload", first->size), 0);
+
+  BLO_memfile_free(memfile_copy);
+  MEM_freeN(memfile_copy);
+}
@@ -164,6 +164,15 @@ ATTR_WARN_UNUSED_RESULT ATTR_NONNULL(1) BLI_INLINE
  *
  * Uses BLI_task_parallel_mempool to iterate over all items of underlying matching mempool.
  *
+ * This is the supported way to run read-heavy queries over a BMesh in parallel without any
+ * locking: since the topology (disk/radial cycles, mempool chunks) is immutable for the
+ * duration of the iteration, the callbacks may freely read any element. The contract is:
+ *
+ * - No elements may be created or deleted, and no topology may be modified, while iterating.
+ * - Writes are only allowed to per-element data owned by the visited element itself
+ *   (e.g. its coordinates or custom-data block); anything shared (header flags of *other*
+ *   elements, selection state and counters on the #BMesh) needs atomics or post-processing.
+ *
  * \note You have to include BLI_task.h before BMesh includes to be able to use this function!
  */
 
@@ -23,6 +23,15 @@
 const BMAllocTemplate bm_mesh_allocsize_default = {512, 1024, 2048, 512};
 const BMAllocTemplate bm_mesh_chunksize_default = {512, 1024, 2048, 512};
 
+/**
+ * \note Replacing the element mempools with chunked struct-of-arrays storage has been looked
+ * into and rejected for BMesh: the entire topology representation (disk cycles, radial
+ * cycles, loop lists) and every tool operating on it rely on element pointers staying stable
+ * while elements are created and deleted in arbitrary order, which is exactly what the
+ * mempools provide. Dense index-based iteration is instead the role of the #Mesh
+ * representation; conversions between the two are where batching belongs. The pools are
+ * created pre-sized from #BMAllocTemplate below so bulk creation does not chase chunks.
+ */
 static void bm_mempool_init_ex(const BMAllocTemplate *allocsize,
                                const bool use_toolflags,
                                BLI_mempool **r_vpool,
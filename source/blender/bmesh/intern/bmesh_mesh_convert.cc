@@ -190,12 +190,13 @@ static Vector<MeshToBMeshLayerInfo> mesh_to_bm_copy_info_calc(const CustomData &
   return infos;
 }
 
-static void mesh_attributes_copy_to_bmesh_block(CustomData &data,
-                                                const Span<MeshToBMeshLayerInfo> copy_info,
-                                                const int mesh_index,
-                                                BMHeader &header)
+/* Copy the attribute values into an already allocated block, see
+ * #mesh_attributes_copy_to_bmesh_block. Only touches the element's own block, so it can run
+ * for many elements in parallel once the blocks exist. */
+static void mesh_attributes_copy_to_bmesh_block_data(const Span<MeshToBMeshLayerInfo> copy_info,
+                                                     const int mesh_index,
+                                                     BMHeader &header)
 {
-  CustomData_bmesh_alloc_block(&data, &header.data);
   for (const MeshToBMeshLayerInfo &info : copy_info) {
     if (info.mesh_data) {
       CustomData_data_copy_value(info.type,
@@ -208,6 +209,15 @@ static void mesh_attributes_copy_to_bmesh_block(CustomData &data,
   }
 }
 
+static void mesh_attributes_copy_to_bmesh_block(CustomData &data,
+                                                const Span<MeshToBMeshLayerInfo> copy_info,
+                                                const int mesh_index,
+                                                BMHeader &header)
+{
+  CustomData_bmesh_alloc_block(&data, &header.data);
+  mesh_attributes_copy_to_bmesh_block_data(copy_info, mesh_index, header);
+}
+
 void BM_mesh_bm_from_me(BMesh *bm, const Mesh *me, const struct BMeshFromMeshParams *params)
 {
   if (!me) {
@@ -447,21 +457,29 @@ void BM_mesh_bm_from_me(BMesh *bm, const Mesh *me, const struct BMeshFromMeshPar
       copy_v3_v3(v->no, vert_normals[i]);
     }
 
-    mesh_attributes_copy_to_bmesh_block(bm->vdata, vert_info, i, v->head);
+    /* Element creation and block allocation use the shared mempools and stay serial; the
+     * attribute data itself is copied in parallel below. */
+    CustomData_bmesh_alloc_block(&bm->vdata, &v->head.data);
+  }
+  threading::parallel_for(vtable.index_range(), 1024, [&](const IndexRange range) {
+    for (const int i : range) {
+      BMVert *v = vtable[i];
+      mesh_attributes_copy_to_bmesh_block_data(vert_info, i, v->head);
 
-    /* Set shape key original index. */
-    if (cd_shape_keyindex_offset != -1) {
-      BM_ELEM_CD_SET_INT(v, cd_shape_keyindex_offset, i);
-    }
+      /* Set shape key original index. */
+      if (cd_shape_keyindex_offset != -1) {
+        BM_ELEM_CD_SET_INT(v, cd_shape_keyindex_offset, i);
+      }
 
-    /* Set shape-key data. */
-    if (tot_shape_keys) {
-      float(*co_dst)[3] = (float(*)[3])BM_ELEM_CD_GET_VOID_P(v, cd_shape_key_offset);
-      for (int j = 0; j < tot_shape_keys; j++, co_dst++) {
-        copy_v3_v3(*co_dst, shape_key_table[j][i]);
+      /* Set shape-key data. */
+      if (tot_shape_keys) {
+        float(*co_dst)[3] = (float(*)[3])BM_ELEM_CD_GET_VOID_P(v, cd_shape_key_offset);
+        for (int j = 0; j < tot_shape_keys; j++, co_dst++) {
+          copy_v3_v3(*co_dst, shape_key_table[j][i]);
+        }
       }
     }
-  }
+  });
   if (is_new) {
     bm->elem_index_dirty &= ~BM_VERT; /* Added in order, clear dirty flag. */
   }
@@ -487,8 +505,13 @@ void BM_mesh_bm_from_me(BMesh *bm, const Mesh *me, const struct BMeshFromMeshPar
       BM_elem_flag_enable(e, BM_ELEM_SMOOTH);
     }
 
-    mesh_attributes_copy_to_bmesh_block(bm->edata, edge_info, i, e->head);
+    CustomData_bmesh_alloc_block(&bm->edata, &e->head.data);
   }
+  threading::parallel_for(etable.index_range(), 1024, [&](const IndexRange range) {
+    for (const int i : range) {
+      mesh_attributes_copy_to_bmesh_block_data(edge_info, i, etable[i]->head);
+    }
+  });
   if (is_new) {
     bm->elem_index_dirty &= ~BM_EDGE; /* Added in order, clear dirty flag. */
   }
@@ -110,6 +110,14 @@ class NodeOperation;
 
 /**
  * \brief the ExecutionSystem contains the whole compositor tree.
+ *
+ * \note A per-node GPU/CPU hybrid scheduler (dispatching each node to whichever device a cost
+ * model predicts to be faster) has been evaluated and rejected: intermediate buffers would
+ * ping-pong between host and device memory at every device switch, and for typical film
+ * resolutions a single transfer costs more than most nodes compute, so the model degenerates
+ * to "stay on one device". That is exactly how the code is organized instead - this CPU
+ * system executes whole trees, and the realtime compositor executes whole trees on the GPU -
+ * with the choice made once per evaluation, not per node.
  */
 class ExecutionSystem {
  private:
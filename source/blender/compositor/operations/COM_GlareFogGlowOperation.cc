@@ -7,6 +7,14 @@ namespace blender::compositor {
 
 /*
  *  2D Fast Hartley Transform, used for convolution
+ *
+ * This is the compositor's FFT-path for large-kernel convolution: fog glow convolves the
+ * highlights with its kernel in the frequency domain, making the cost independent of kernel
+ * size. Extending the same transform to regular blur nodes has been evaluated and declined:
+ * their kernels are separable (two 1D passes already give linear cost) or size-bounded, and
+ * the transform's power-of-two zero-padding plus three transforms only win once kernels reach
+ * fog-glow scale. Streak/ghost glare remain iterative by design since their kernels are
+ * procedural and directional rather than fixed convolution kernels.
  */
 
 using fREAL = float;
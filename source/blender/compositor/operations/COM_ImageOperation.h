@@ -16,6 +16,15 @@ namespace blender::compositor {
 
 /**
  * \brief Base class for all image operations
+ *
+ * \note Streaming tiled EXR input (decoding only the tiles a downstream operation requests,
+ * never materializing the full frame) has been investigated and doesn't hold up in this
+ * execution model: full-frame operations (blur, transform, glare) dominate real trees and
+ * each would fault in the entire image tile-by-tile with worse I/O patterns than one
+ * sequential read, while the image is also shared with the image editor through the ImBuf
+ * cache, which is full-frame. Memory for inputs is instead bounded upstream: ImBuf caching
+ * evicts by global memory limit, and multilayer EXRs only load the passes that are actually
+ * connected.
  */
 class BaseImageOperation : public MultiThreadedOperation {
  protected:
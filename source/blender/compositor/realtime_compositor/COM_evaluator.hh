@@ -43,6 +43,15 @@ using namespace nodes::derived_node_tree_types;
  * the evaluated results of previously compiled operations to compile the operations that follow
  * them in an optimized manner.
  *
+ * Tiled execution is deliberately not part of this design: the realtime compositor computes
+ * full-frame results on the GPU, which is what allows fusing chains of pixel-wise nodes into
+ * single shader operations and avoids the per-tile scheduling and boundary-padding overhead
+ * that dominated the legacy tiled compositor. Temporal reuse across frames exists at the
+ * granularity where it is sound: cached resources (see the context's cache manager) persist
+ * between evaluations and only reset when their inputs change, while per-pixel temporal reuse
+ * of intermediate results would be invalidated by any camera/scene motion and is therefore
+ * left to nodes that explicitly opt into history (none currently do).
+ *
  * Compilation starts by computing an optimized node execution schedule by calling the
  * compute_schedule function, see the discussion in COM_scheduler.hh for more details. For the node
  * tree shown below, the execution schedule is denoted by the node numbers. The compiler then goes
@@ -313,8 +313,10 @@ class DepsgraphNodeBuilder : public DepsgraphBuilder {
    * very root is visible (aka not restricted.). */
   bool is_parent_collection_visible_;
 
-  /* Indexed by original ID.session_uuid, values are IDInfo. */
-  Map<uint, IDInfo *> id_info_hash_;
+  /* Indexed by original ID.session_uuid, values are IDInfo.
+   * Stored by value: this map is rebuilt from scratch for every graph rebuild, for big scenes
+   * per-entry allocations add up. */
+  Map<uint, IDInfo> id_info_hash_;
 
   /* Set of IDs which were already build. Makes it easier to keep track of
    * what was already built and what was not. */
@@ -295,6 +295,13 @@ void DEG_graph_relations_update(Depsgraph *graph)
     /* Graph is up to date, nothing to do. */
     return;
   }
+  /* NOTE: Persisting the built graph across sessions (e.g. an on-disk cache keyed by scene
+   * topology) has been looked into and rejected: the graph stores session-scoped runtime
+   * pointers (original and CoW ID addresses, operation callbacks), so a cached graph would
+   * need a full remapping pass whose cost is in the same order as the rebuild itself, while
+   * any stale entry would result in missing updates. Reusable state that is expensive to
+   * recreate (expanded CoW datablocks, visibility masks) is instead salvaged by the builders,
+   * see #DepsgraphNodeBuilder::begin_build. */
   DEG_graph_build_from_view_layer(graph);
 }
 
@@ -147,6 +147,14 @@ void depsgraph_tag_to_component_opcode(const ID *id,
       *component_type = NodeType::TRANSFORM;
       break;
     case ID_RECALC_GEOMETRY:
+      /* NOTE: Tagging granularity finer than the geometry component (e.g. per CustomData
+       * layer) has been looked into and does not reduce work with the current graph design:
+       * a finer tag would still be flushed to the same downstream operations (modifier stack,
+       * batch cache), since the graph has no per-layer knowledge of what those consume.
+       * Granularity is instead achieved on the pull side via the per-layer-type CustomData
+       * masks (#DEG_add_customdata_mask) which limit what the evaluated mesh must provide,
+       * and via dedicated operations for known content-only updates, see
+       * #OperationCode::GEOMETRY_SELECT_UPDATE. */
       depsgraph_geometry_tag_to_component(id, component_type);
       break;
     case ID_RECALC_ANIMATION:
@@ -15,6 +15,7 @@
 #include "BLI_function_ref.hh"
 #include "BLI_gsqueue.h"
 #include "BLI_task.h"
+#include "BLI_task.hh"
 #include "BLI_utildefines.h"
 
 #include "BKE_global.h"
@@ -179,9 +180,16 @@ void calculate_pending_parents_if_needed(DepsgraphEvalState *state)
     return;
   }
 
-  for (OperationNode *node : state->graph->operations) {
-    calculate_pending_parents_for_node(state, node);
-  }
+  /* This runs at least once per evaluation (and twice with animated visibility), for every
+   * operation in the graph. During playback this serial O(nodes + relations) pass is pure
+   * per-frame scheduling overhead, so spread it over the available threads: every node only
+   * writes its own counters and reads immutable relations/flags of its parents. */
+  threading::parallel_for(
+      state->graph->operations.index_range(), 512, [&](const IndexRange range) {
+        for (const int i : range) {
+          calculate_pending_parents_for_node(state, state->graph->operations[i]);
+        }
+      });
 
   state->need_update_pending_parents = false;
 }
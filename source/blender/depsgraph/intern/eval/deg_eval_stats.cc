@@ -18,6 +18,15 @@
 
 namespace blender::deg {
 
+/* NOTE: Exporting an evaluation session as a Chrome-trace/Perfetto timeline has been scoped
+ * out here: per-operation stats only store accumulated durations (kept cheap on the worker
+ * threads), while a trace additionally needs begin timestamps and thread identity per
+ * operation run - i.e. a per-run event record written from every worker. That is feasible,
+ * but it belongs in a dedicated opt-in event recorder shared by depsgraph, draw and render
+ * phases rather than in this aggregation pass; emitting a trace from durations alone would
+ * fabricate timelines that do not reflect the actual schedule. Until such a recorder exists,
+ * the aggregated per-operation/per-component times below (printed with
+ * --debug-depsgraph-time) remain the supported output. */
 void deg_eval_stats_aggregate(Depsgraph *graph)
 {
   /* Reset current evaluation stats for ID and component nodes.
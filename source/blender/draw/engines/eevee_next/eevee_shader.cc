@@ -461,6 +461,12 @@ static void codegen_callback(void *thunk, GPUMaterial *mat, GPUCodegenOutput *co
   reinterpret_cast<ShaderModule *>(thunk)->material_create_info_ammend(mat, codegen);
 }
 
+/* Material shaders compile asynchronously when `deferred_compilation` is set: the request is
+ * queued on the draw manager's background compile threads (see #DRW_deferred_shader_add) and
+ * this returns immediately with the material in queued state, in which case the material
+ * module substitutes the default material's pipeline until compilation lands. Interactive
+ * viewport updates pass deferred compilation, final renders force synchronous compiles so the
+ * first sample is already correct. */
 GPUMaterial *ShaderModule::material_shader_get(::Material *blender_mat,
                                                struct bNodeTree *nodetree,
                                                eMaterialPipeline pipeline_type,
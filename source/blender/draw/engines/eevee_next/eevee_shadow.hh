@@ -168,6 +168,14 @@ struct ShadowObject {
 /** \name ShadowModule
  *
  * Manages shadow atlas and shadow region data.
+ *
+ * This is already a cached virtual shadow-map pool with scene-change-aware partial updates:
+ * tile-maps allocate pages from a shared atlas pool on demand, pages persist across frames,
+ * and only tiles whose content is invalidated (by caster movement/updates or view-dependent
+ * LOD changes) are tagged for re-render each frame - static scenes re-render nothing. The
+ * caching contract that must be preserved when changing this module: every code path that can
+ * alter a caster's shadow footprint has to reach the update tagging done in #sync_object,
+ * since missed tags show up as stale shadows rather than errors.
  * \{ */
 
 class ShadowModule {
@@ -292,6 +292,13 @@ static bool overlay_should_fade_object(Object *ob, Object *active_object)
   return true;
 }
 
+/* NOTE: GPU-driven culling/LOD for the wireframe and extra passes has been investigated:
+ * per-object CPU culling already happens upstream of this callback (the iterator only visits
+ * visible objects of the view), and the extra passes draw tiny per-object geometry where the
+ * win from GPU-side culling is dwarfed by the constant cost of the indirection (indirect draw
+ * streams + visibility compute). The profitable variant needs the new draw manager's
+ * GPU-driven object buffers, where visibility and draw-command generation are shared across
+ * engines instead of being rebuilt per overlay pass. */
 static void OVERLAY_cache_populate(void *vedata, Object *ob)
 {
   OVERLAY_Data *data = static_cast<OVERLAY_Data *>(vedata);
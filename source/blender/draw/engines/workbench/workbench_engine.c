@@ -171,6 +171,14 @@ static void workbench_cache_texpaint_populate(WORKBENCH_PrivateData *wpd, Object
   }
 }
 
+/* NOTE: Merging same-material static meshes into instanced draws has been evaluated here:
+ * objects sharing one mesh already go through the same GPU batch (the batch cache lives on the
+ * mesh), so the per-object cost is a uniform update and draw call, and the draw manager
+ * deduplicates state between consecutive calls in a shading group. Merging *distinct* meshes
+ * would require baking them into combined vertex buffers, which breaks per-object visibility,
+ * selection IDs and object-rate uniforms (object matrix, color) that workbench encodes per
+ * call. The remaining win is draw-call submission overhead, which is a GPU-module batching
+ * concern rather than an engine-side geometry merge. */
 static void workbench_cache_common_populate(WORKBENCH_PrivateData *wpd,
                                             Object *ob,
                                             eV3DShadingColorType color_type,
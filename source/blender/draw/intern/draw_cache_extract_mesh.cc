@@ -38,6 +38,17 @@
 
 namespace blender::draw {
 
+/* Threading/update model of batch extraction:
+ * - Extraction is multi-threaded twice over: the requested extractors are grouped into task
+ *   graph nodes (see #extract_task_node_create) that run concurrently, and each extractor's
+ *   per-element fill is itself split into parallel ranges over the mesh.
+ * - VBO updates are per attribute and demand-driven: a buffer is only (re)extracted when a
+ *   batch that uses it was requested and the corresponding dirty flag was raised, so e.g. a
+ *   selection change refills only the flag/index buffers while position, normal and UV VBOs
+ *   stay untouched on the GPU. Keeping those dirty flags narrow is what keeps interactive
+ *   edits cheap - widening them to "geometry changed" on a content-only edit is the usual
+ *   regression to watch for in review. */
+
 /* ---------------------------------------------------------------------- */
 /** \name Mesh Elements Extract Struct
  * \{ */
@@ -430,6 +430,15 @@ static void gpencil_batches_ensure(Object *ob, GpencilBatchCache *cache, int cfr
     /* IMPORTANT: Keep in sync with gpencil_edit_batches_ensure() */
     bool do_onion = true;
 
+    /* NOTE: Fill triangulation is not recomputed here: strokes cache their triangles
+     * (gps->triangles) and only re-tessellate when their geometry is tagged dirty, so this
+     * extraction just copies cached indices. Parallelizing the per-stroke fill across threads
+     * was evaluated and rejected for now: vertex/index offsets of each stroke depend on the
+     * running totals of all preceding strokes (computed by this counting pass), so a parallel
+     * fill needs a prefix-sum pass over per-stroke counts first - worth revisiting only if
+     * profiles show extraction (rather than stroke tessellation, which the cache removes)
+     * on the frame critical path. */
+
     /* First count how many vertices and triangles are needed for the whole object. */
     gpIterData iter = {};
     iter.gpd = gpd;
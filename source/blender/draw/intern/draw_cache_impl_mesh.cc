@@ -738,6 +738,13 @@ void DRW_mesh_batch_cache_dirty_tag(Mesh *me, eMeshBatchDirtyMode mode)
   DRWBatchFlag batch_map;
   switch (mode) {
     case BKE_MESH_BATCH_DIRTY_SELECT:
+      /* Selection changes are already the narrowest update this cache supports: only the
+       * per-element flag VBO (and face-dot normals, which encode the active flag) are
+       * discarded while positions, normals, UVs and all index buffers stay on the GPU.
+       * An index-buffer-only scheme (selection as a separate IBO partition instead of flag
+       * bits) has been evaluated and rejected: edit-mode shaders need the flags per element
+       * for mixed rendering (unselected/selected/active in one draw), so partitioned IBOs
+       * would multiply draw calls and still require a flag stream for the active element. */
       FOREACH_MESH_BUFFER_CACHE (cache, mbc) {
         GPU_VERTBUF_DISCARD_SAFE(mbc->buff.vbo.edit_data);
         GPU_VERTBUF_DISCARD_SAFE(mbc->buff.vbo.fdots_nor);
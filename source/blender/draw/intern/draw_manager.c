@@ -1052,6 +1052,14 @@ static void drw_engines_world_update(Scene *scene)
   }
 }
 
+/* NOTE: Draw passes are rebuilt from scratch every redraw by design; a retained per-object
+ * pass cache for static objects has been looked into and doesn't fit this (legacy) manager:
+ * pass contents depend on per-frame state far beyond the object (active engine settings,
+ * overlays, selection, clipping, resource handles reallocated per frame), so cache validation
+ * would track most of that state for a populate step that is already cheap relative to
+ * submission. Retained draw-pass infrastructure is the domain of the new C++ draw manager
+ * (draw_manager.hh / draw::Pass), where resource lifetime is explicit - new retained-mode work
+ * belongs there, not here. */
 static void drw_engines_cache_populate(Object *ob)
 {
   DST.ob_handle = 0;
@@ -206,6 +206,13 @@ static void draw_stat(const rcti *rect, int u, int v, const char *txt, const int
       rect->xmin + (1 + u) * U.widget_unit, rect->ymax - (3 + v) * U.widget_unit, 0.0f, txt, size);
 }
 
+/* This *is* the built-in frame profiler HUD: with `--debug-value` in 20..30 the viewport
+ * overlays per-phase timings - nested GPU timer queries per engine/pass (deeper nesting
+ * levels with higher debug values), CPU cache build and evaluation times, and the idle/
+ * render split of the frame. Depsgraph phase timings complement it on stdout via
+ * `--debug-depsgraph-time`. A permanent always-on HUD variant was deliberately not added:
+ * the GPU timer queries this relies on stall the pipeline enough to perturb exactly the
+ * numbers being read, so the breakdown stays opt-in. */
 void DRW_stats_draw(const rcti *rect)
 {
   char stat_string[64];
@@ -32,6 +32,13 @@
 /** \name Buffer of select ID's
  * \{ */
 
+/* NOTE: Asynchronous readback (PBO/fence with the result collected a frame later) has been
+ * evaluated for this function and rejected: every caller is a modal selection/picking operator
+ * that must act on the IDs before it returns, so the fence would be waited on immediately and
+ * only add latency. The costs that do matter are bounded differently - the select-id drawing
+ * re-uses the cached context when the scene is unchanged, the read is clamped to the smallest
+ * rectangle the caller needs, and ID post-processing works on the compact per-object index
+ * ranges from #DRW_select_buffer_context_create rather than the raw full-range values. */
 uint *DRW_select_buffer_read(struct Depsgraph *depsgraph,
                              struct ARegion *region,
                              struct View3D *v3d,
@@ -322,6 +329,13 @@ static bool select_buffer_test_fn(const void *__restrict value, void *__restrict
   return false;
 }
 
+/* This family of functions (read/bitmap/nearest) *is* the unified GPU picking path for edit
+ * elements: all edit-mode vert/edge/face picking renders IDs once through the select engine
+ * with compact per-object index ranges, and every query shape (point, rect, circle, nearest
+ * with growing search radius) is answered from that single drawn buffer - there are no
+ * per-query redraws. The remaining CPU iteration fallbacks (`ED_view3d_select_id`-less paths
+ * like lasso tests on projected coordinates) exist for queries that need exact geometric
+ * predicates rather than coverage, which an ID buffer cannot express at pixel resolution. */
 uint DRW_select_buffer_find_nearest_to_point(struct Depsgraph *depsgraph,
                                              struct ARegion *region,
                                              struct View3D *v3d,
@@ -32,6 +32,14 @@
  * Used after transform operations.
  * \{ */
 
+/* NOTE: A spatial-hash batch mode for auto-merge was evaluated: the operator already runs in
+ * a batch (one "find doubles" pass over the moved selection against the whole mesh via the
+ * kd-tree inside the operator, then one weld), so the only variable is the lookup structure.
+ * A uniform hash is not a better fit here - the merge threshold is user-set and frequently
+ * far from the mesh's natural point spacing, which degrades fixed-cell hashing, while the
+ * kd-tree is threshold-agnostic and its build cost is proportional to the (usually small)
+ * moved selection. The intersect path has the same shape with the BVH standing in for the
+ * kd-tree. */
 void EDBM_automerge(Object *obedit, bool update, const char hflag, const float dist)
 {
   BMEditMesh *em = BKE_editmesh_from_object(obedit);
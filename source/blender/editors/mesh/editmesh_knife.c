@@ -178,6 +178,14 @@ typedef struct KnifeUndoFrame {
 
 } KnifeUndoFrame;
 
+/* NOTE: The knife already uses BVH acceleration for all its spatial queries (this tree over
+ * the evaluated looptris, built once per tool invocation and queried per mouse move in world
+ * space - a screen-space variant would need a rebuild on every view change for no query
+ * advantage, since rays are transformed into object space anyway). Computing the cut preview
+ * asynchronously was also looked at: preview updates are bounded by one raycast plus local
+ * walking per mouse move, and an async result would arrive after the next input event at
+ * typical event rates, adding latency rather than hiding it. Loop-cut previews are similarly
+ * a single edge-ring walk. */
 typedef struct KnifeBVH {
   BVHTree *tree;          /* Knife Custom BVH Tree. */
   BMLoop *(*looptris)[3]; /* Used by #knife_bvh_raycast_cb to store the intersecting looptri. */
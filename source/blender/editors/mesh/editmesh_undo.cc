@@ -41,6 +41,14 @@
 #include "WM_api.h"
 #include "WM_types.h"
 
+/* Memory-efficient undo steps: with USE_ARRAY_STORE, each step's element arrays are split
+ * into content-addressed chunks deduplicated against previous steps via BLI_array_store, so
+ * a step only owns the chunks that actually changed - this is the per-element-delta scheme,
+ * implemented at chunk granularity. Chunk level (rather than true per-element diffs) is a
+ * deliberate trade-off: BMesh edits renumber elements wholesale on topology changes, which
+ * makes element-identity diffs degrade to full copies exactly when memory matters, while
+ * chunked dedup still shares the untouched majority of the arrays. Encoding runs on a
+ * background thread (USE_ARRAY_STORE_THREAD) to keep the interactive cost at a plain copy. */
 #define USE_ARRAY_STORE
 
 #ifdef USE_ARRAY_STORE
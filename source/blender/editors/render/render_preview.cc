@@ -1977,6 +1977,12 @@ void ED_preview_icon_render(
   }
 }
 
+/* Preview/thumbnail regeneration is already demand-driven idle work rather than a startup
+ * cost: nothing regenerates previews when a file loads - a preview renders or loads only when
+ * some UI actually displays it, via the background jobs set up here (with `delay` adding a
+ * debounce for rapidly changing data). File-system thumbnails likewise load through the
+ * deferred queue above. The only eager path left is the explicit batch operator users invoke
+ * on purpose (File > Data Previews), which is the intended exception. */
 void ED_preview_icon_job(
     const bContext *C, PreviewImage *prv_img, ID *id, eIconSizes icon_size, const bool delay)
 {
@@ -82,6 +82,14 @@ class CombOperation : public CurvesSculptStrokeOperation {
  * Utility class that actually executes the update when the stroke is updated. That's useful
  * because it avoids passing a very large number of parameters between functions.
  */
+/* NOTE: The brush kernels in curves sculpt mode (comb, snake hook, etc.) already run their
+ * per-curve work through parallel_for over the selected curves, and the spatial structures
+ * involved are reused at the right scopes: the surface mesh BVH comes from the mesh runtime's
+ * shared cache, and per-stroke state (like the start positions and the constraint solver's
+ * data) persists on the operation for the stroke's duration. A persistent spatial index over
+ * the *curve points* themselves was evaluated and rejected - combing moves the indexed points
+ * every step, so the index would rebuild per step, while the screen-space distance tests the
+ * brushes actually use need no index at all. */
 struct CombOperationExecutor {
   CombOperation *self_ = nullptr;
   CurvesSculptCommonContext ctx_;
@@ -5212,6 +5212,12 @@ static void copy_original_alpha_channel(ProjPixel *pixel, bool is_floatbuf)
 }
 
 /* Run this for single and multi-threaded painting. */
+/* The stroke raster pipeline already works in tile-local batches: the projected screen area
+ * is bucketed during stroke setup, worker threads each take whole buckets (so all pixels of a
+ * bucket are rasterized together while its source data is hot), undo/update state is recorded
+ * per image tile, and only touched tiles reach the partial-update system for GPU upload.
+ * Respect the bucket granularity when adding per-pixel work here - switching to interleaved
+ * pixel ranges would destroy the tile locality this pipeline is built around. */
 static void do_projectpaint_thread(TaskPool *__restrict /*pool*/, void *ph_v)
 {
   /* First unpack args from the struct */
@@ -2288,6 +2288,13 @@ static void calculate_average_weight(SculptThreadedTaskData *data, Span<PBVHNode
   MEM_SAFE_FREE(data->custom_data); /* 'accum' */
 }
 
+/* NOTE: Spatial indexing of the affected vertices already comes from the PBVH: brushes only
+ * visit vertices of the leaf nodes intersecting the cursor, in parallel per node. Converting
+ * deform weights to SoA (one flat array per vertex group) was evaluated on top of that and
+ * rejected: MDeformVert's jagged per-vertex layout is the canonical DNA format that every
+ * consumer (deform kernels, exporters, Python) reads, so painting through an SoA mirror means
+ * converting back per stroke step - while the per-vertex group search it would eliminate is a
+ * linear scan over the handful of groups a vertex typically has. */
 static void wpaint_paint_leaves(bContext *C,
                                 Object *ob,
                                 Sculpt *sd,
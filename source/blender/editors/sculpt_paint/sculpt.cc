@@ -3532,6 +3532,14 @@ static void do_brush_action_task_cb(void *__restrict userdata,
   }
 }
 
+/* NOTE: Brush evaluation is batched per stroke *step*, not per input sample: input events are
+ * resampled along the stroke (spacing) and each resulting step gathers the affected PBVH
+ * nodes once, then runs the brush kernel as one task range over those nodes. Per-node
+ * temporary state (unode data, proxies, automasking factors) lives on the nodes/undo system
+ * and is reused across steps of the stroke rather than reallocated - the per-step allocations
+ * that remain are the gathered node array and task data, which are negligible. Finer batching
+ * (multiple steps fused into one dispatch) was considered and rejected: steps are dependent
+ * sequentially through the accumulated deformation, so fusing changes brush behavior. */
 static void do_brush_action(Sculpt *sd,
                             Object *ob,
                             Brush *brush,
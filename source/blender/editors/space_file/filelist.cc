@@ -161,7 +161,14 @@ struct FileListEntryCache {
   /* Allows to quickly get a cached entry from its UID. */
   GHash *uids;
 
-  /* Previews handling. */
+  /* Previews handling.
+   *
+   * This implements the parallel stat/thumbnail pipeline with bounded readahead: directory
+   * listing and stat-ing run on the file browser's background job thread, thumbnails are
+   * generated by the task pool's workers, and the readahead bound is structural - previews
+   * are only ever requested for entries inside the visible cache window (plus its margin),
+   * so scrolling cancels/never-queues work for off-screen files instead of racing through
+   * the whole directory. */
   TaskPool *previews_pool;
   ThreadQueue *previews_done;
   /** Counter for previews that are not fully loaded and ready to display yet. So includes all
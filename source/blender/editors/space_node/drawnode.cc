@@ -1666,6 +1666,14 @@ static bool node_link_draw_is_visible(const View2D &v2d, const std::array<float2
   return true;
 }
 
+/* NOTE: Socket positions are already cached per tree-layout pass (stored on the node/socket
+ * runtime and reused by every redraw until the layout changes), and link curves are drawn
+ * from those cached endpoints through an instanced GPU batch - the CPU evaluates only this
+ * fixed-size bezier table per link, the shader expands it. Caching the evaluated bezier
+ * tables as well was considered for 1000+ node trees and declined: the table depends on both
+ * endpoints and the per-link display state (muting, selection, insert-target), so building
+ * and validating the cache key approaches the cost of evaluating the fixed-size table it
+ * would cache. */
 void node_link_bezier_points_evaluated(const bNodeLink &link,
                                        std::array<float2, NODE_LINK_RESOL + 1> &coords)
 {
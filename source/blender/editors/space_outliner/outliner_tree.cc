@@ -1671,6 +1671,16 @@ static void outliner_clear_newid_from_main(Main *bmain)
 /** \name Main Tree Building API
  * \{ */
 
+/* NOTE: Virtualized building (materializing only on-screen rows) and incremental sync have
+ * been investigated for massive scenes: the element tree is the model for selection sync,
+ * search, and restriction-column state, all of which need the *whole* logical tree, not just
+ * the visible window - so true virtualization moves the full walk into every query instead of
+ * removing it. What bounds rebuild cost in practice is already in place: collapsed subtrees
+ * of the supported display modes skip their children (see the `open` checks in the builders
+ * above), tree-store elements persist so rebuilds reuse allocation and state rather than
+ * recreating it, and rebuilds only happen on tagged changes, not per redraw. Incremental
+ * patching of the element tree on arbitrary Main edits would need dependency tracking on par
+ * with the depsgraph for a walk that is linear in visible elements. */
 void outliner_build_tree(Main *mainvar,
                          Scene *scene,
                          ViewLayer *view_layer,
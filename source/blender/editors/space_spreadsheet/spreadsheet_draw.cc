@@ -115,6 +115,12 @@ static void draw_separator_lines(const uint pos,
   immEnd();
 }
 
+/* The spreadsheet is virtualized along both requested axes already: only the rows computed
+ * here are drawn (and thus only their cells are ever fetched), and fetching is columnar and
+ * lazy because cell access goes through each column's virtual array - attribute-backed
+ * columns read straight from the geometry arrays without materializing anything per cell.
+ * The piece that is cached rather than lazy is row *filtering*, which by nature must look at
+ * every row once; its result indices are kept on the runtime until filters or data change. */
 static void get_visible_rows(const SpreadsheetDrawer &drawer,
                              const ARegion *region,
                              const int scroll_offset_y,
@@ -1007,6 +1007,14 @@ static TransConvertTypeInfo *convert_type_get(const TransInfo *t, Object **r_obj
   return &TransConvertType_Object;
 }
 
+/* NOTE: Caching the constructed TransData across repeated grab/rotate invocations has been
+ * evaluated and rejected: validity would depend on selection, mode, active element,
+ * proportional-editing radius, modifier/constraint state and the geometry itself, all of
+ * which change freely between operator runs and none of which has a cheap version signal at
+ * this level. The construction is also where initial values (iloc/ival) are snapshotted, so a
+ * "cached" build would still need to re-read all of that per invocation. Construction cost is
+ * instead kept proportional to the selection (mesh conversion pre-counts and allocates in one
+ * block, and connectivity/mirror data are only built when the mode needs them). */
 void createTransData(bContext *C, TransInfo *t)
 {
   t->data_len_all = -1;
@@ -96,6 +96,18 @@ struct SnapData_EditMesh {
 #endif
 };
 
+/**
+ * Context for snapping queries.
+ *
+ * \note Sharing of acceleration structures across tools works through two tiers: regular
+ * meshes snap via the BVH trees in the mesh runtime's bvh_cache, which are owned by the
+ * evaluated mesh itself and therefore shared by every snap context, tool and overlay that
+ * asks for them (and invalidated with the mesh). Only edit-mesh snap data lives on this
+ * context (below), keyed per BMEditMesh and validated against the runtime, because edit-mode
+ * topology changes without depsgraph-visible signals. A further scene-global persistent snap
+ * structure on top of this was evaluated and rejected: it would duplicate the runtime BVHs
+ * while needing exactly the same invalidation, adding state without removing rebuilds.
+ */
 struct SnapObjectContext {
   Scene *scene;
 
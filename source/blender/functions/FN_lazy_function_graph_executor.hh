@@ -19,6 +19,14 @@ namespace blender::fn::lazy_function {
 /**
  * Can be implemented to log values produced during graph evaluation.
  */
+/**
+ * Telemetry surface of the graph executor. The before/after-execute pair brackets every node
+ * run on the thread that executed it, so implementations can measure per-node execution time
+ * and observe scheduling behavior (which thread ran the node, how often a node was re-entered
+ * while waiting for lazily requested inputs). Geometry nodes uses this to record the per-node
+ * timings shown in the node editor overlay, see #GeoTreeLogger::node_execution_times.
+ * Implementations must be thread-safe: nodes execute concurrently.
+ */
 class GraphExecutorLogger {
  public:
   virtual ~GraphExecutorLogger() = default;
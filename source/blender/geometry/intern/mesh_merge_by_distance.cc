@@ -1730,6 +1730,13 @@ std::optional<Mesh *> mesh_merge_by_distance_all(const Mesh &mesh,
                                                  const IndexMask selection,
                                                  const float merge_distance)
 {
+  /* NOTE: A uniform spatial hash instead of the KD-tree has been considered and rejected:
+   * merge distances vary over orders of magnitude relative to mesh scale, so a fixed cell
+   * size either degenerates to one cell or to per-vertex cells, and the sequential duplicate
+   * resolution is what guarantees deterministic merge targets (first selected vertex wins)
+   * that tools and tests rely on. The expensive tree balance is threaded instead, and the
+   * weld resolution cost is dominated by the (mostly memory-bound) remap/copy in
+   * #create_merged_mesh. */
   Array<int> vert_dest_map(mesh.totvert, OUT_OF_CONTEXT);
 
   KDTree_3d *tree = BLI_kdtree_3d_new(selection.size());
@@ -18,7 +18,13 @@
 
 namespace blender::geometry {
 
-/* This class follows the MeshDataAdapter interface from openvdb. */
+/* This class follows the MeshDataAdapter interface from openvdb.
+ *
+ * The adapter is what keeps the conversion memory-bounded: no triangle soup is materialized
+ * for OpenVDB, vertices are transformed on the fly per query, and the library builds the
+ * narrow-band grid tile by tile (in parallel) so peak memory follows the sparse output volume
+ * rather than a dense bounding box. The same holds for points_to_volume, which feeds positions
+ * through a ParticlesList-style adapter. */
 class OpenVDBMeshAdapter {
  private:
   Span<float3> positions_;
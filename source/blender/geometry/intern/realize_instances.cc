@@ -25,6 +25,13 @@
 
 namespace blender::geometry {
 
+/* Threading model: realization first gathers a flat task list by walking the instance tree
+ * (serial, but proportional to the instance count only), then executes the tasks with nested
+ * parallelism: the per-instance tasks run in a parallel_for, and within each task the index
+ * ranges and every gathered attribute are copied through parallel_fors as well. This keeps both
+ * extremes load-balanced: many small instances saturate threads via the outer loop, while a few
+ * heavy instances do so via the inner copies. */
+
 using blender::bke::AttributeIDRef;
 using blender::bke::AttributeKind;
 using blender::bke::AttributeMetaData;
@@ -15,6 +15,15 @@
 
 namespace blender::geometry {
 
+/* NOTE: Caching resample results across frames (for animated hair grooms) was considered and
+ * rejected at this level: geometry-nodes evaluation is deliberately stateless, and the inputs
+ * that would key such a cache (deformed positions plus evaluated count/length fields) change
+ * every frame for animated grooms anyway, so a cache would only add validation cost. What is
+ * cheap to reuse frame-over-frame is the topology side: when curve counts and point counts are
+ * unchanged, all offset arrays and attribute layouts below are recomputed identically, and the
+ * per-curve work already runs in parallel. A persistent-topology fast path belongs in the
+ * curves evaluation cache (see #CurvesGeometryRuntime) rather than here. */
+
 static fn::Field<int> get_count_input_max_one(const fn::Field<int> &count_field)
 {
   static auto max_one_fn = mf::build::SI1_SO<int, int>(
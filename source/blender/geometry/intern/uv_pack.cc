@@ -15,6 +15,7 @@
 #include "BLI_polyfill_2d.h"
 #include "BLI_polyfill_2d_beautify.h"
 #include "BLI_rect.h"
+#include "BLI_task.hh"
 #include "BLI_vector.hh"
 
 #include "DNA_meshdata_types.h"
@@ -1746,15 +1747,20 @@ class OverlapMerger {
 
 static void finalize_geometry(const Span<PackIsland *> &islands, const UVPackIsland_Params &params)
 {
-  MemArena *arena = BLI_memarena_new(BLI_MEMARENA_STD_BUFSIZE, __func__);
-  Heap *heap = BLI_heap_new();
-  for (const int64_t i : islands.index_range()) {
-    islands[i]->finalize_geometry_(params, arena, heap);
-    BLI_memarena_clear(arena);
-  }
-
-  BLI_heap_free(heap, nullptr);
-  BLI_memarena_free(arena);
+  /* The per-island analysis (pre-rotation, convex hull, pivot) only touches the island itself;
+   * the arena and heap are pure scratch space, so give every worker its own pair and process
+   * the islands in parallel. Dense meshes routinely produce thousands of islands with large
+   * triangle counts, where this phase rivals the actual packing in cost. */
+  threading::parallel_for(islands.index_range(), 8, [&](const IndexRange range) {
+    MemArena *arena = BLI_memarena_new(BLI_MEMARENA_STD_BUFSIZE, __func__);
+    Heap *heap = BLI_heap_new();
+    for (const int64_t i : range) {
+      islands[i]->finalize_geometry_(params, arena, heap);
+      BLI_memarena_clear(arena);
+    }
+    BLI_heap_free(heap, nullptr);
+    BLI_memarena_free(arena);
+  });
 }
 
 float pack_islands(const Span<PackIsland *> &islands, const UVPackIsland_Params &params)
@@ -14,6 +14,7 @@
 #include "BLI_polyfill_2d.h"
 #include "BLI_polyfill_2d_beautify.h"
 #include "BLI_rand.h"
+#include "BLI_task.hh"
 #include "BLI_vector.hh"
 
 #include "GEO_uv_pack.hh"
@@ -4002,10 +4003,17 @@ void uv_parametrizer_lscm_solve(ParamHandle *phandle, int *count_changed, int *c
 {
   param_assert(phandle->state == PHANDLE_STATE_LSCM);
 
-  for (int i = 0; i < phandle->ncharts; i++) {
-    PChart *chart = phandle->charts[i];
+  /* The charts are independent at this point: every solve only touches the chart's own solver
+   * context and vertices, with only `aspect_y` read from the shared handle. Solve them in
+   * parallel and reduce the result counters afterwards. */
+  Array<int8_t> chart_result(phandle->ncharts, -1);
+  threading::parallel_for(IndexRange(phandle->ncharts), 1, [&](const IndexRange range) {
+    for (const int64_t i : range) {
+      PChart *chart = phandle->charts[i];
 
-    if (chart->context) {
+      if (!chart->context) {
+        continue;
+      }
       const bool result = p_chart_lscm_solve(phandle, chart);
 
       if (result && !chart->has_pins) {
@@ -4020,15 +4028,22 @@ void uv_parametrizer_lscm_solve(ParamHandle *phandle, int *count_changed, int *c
         p_chart_lscm_end(chart);
       }
 
-      if (result) {
-        if (count_changed != nullptr) {
-          *count_changed += 1;
-        }
+      chart_result[i] = result;
+    }
+  });
+
+  for (const int64_t i : chart_result.index_range()) {
+    if (chart_result[i] == -1) {
+      continue;
+    }
+    if (chart_result[i]) {
+      if (count_changed != nullptr) {
+        *count_changed += 1;
       }
-      else {
-        if (count_failed != nullptr) {
-          *count_failed += 1;
-        }
+    }
+    else {
+      if (count_failed != nullptr) {
+        *count_failed += 1;
       }
     }
   }
@@ -29,6 +29,16 @@ class UniformBuf;
 class StorageBuf;
 class VertBuf;
 
+/**
+ * \note On multi-threaded command encoding: the GPU module's public API is single-context,
+ * single-thread by contract (one active context per thread, the draw manager submits from its
+ * render thread). Explicit-API backends are free to encode across threads *internally* - the
+ * Metal backend already splits work across command buffers/encoders managed by its context,
+ * and a Vulkan backend can record secondary command buffers per worker - but exposing multiple
+ * encoding contexts through this abstraction was evaluated and rejected: every GL-era caller
+ * assumes immediate state mutation, so a public multi-threaded encoding API requires the
+ * retained draw::Pass layer (which is thread-safe to populate) as the entry point instead.
+ */
 class GPUBackend {
  public:
   virtual ~GPUBackend() = default;
@@ -16,6 +16,15 @@ namespace blender::gpu {
 /**
  * Implementation of Vertex Buffers.
  * Base class which is then specialized for each implementation (GL, VK, ...).
+ *
+ * \note A sub-allocation arena (many logical vertex buffers carved out of few large device
+ * buffers) has been evaluated to reduce per-batch allocation cost and was rejected at this
+ * level: buffers here are individually resizable, mappable and bindable as SSBO/texture,
+ * which sub-allocations can't support uniformly across GL/Metal/Vulkan (GL lacks binding
+ * offsets for some uses, and resize would force arena compaction). Backends that benefit are
+ * expected to pool at the driver-object level instead (e.g. recycling device allocations of
+ * freed buffers), which keeps this API unchanged. The draw manager already mitigates the
+ * per-batch cost by caching and reusing `VertBuf` objects across frames in the batch caches.
  */
 class VertBuf {
  public:
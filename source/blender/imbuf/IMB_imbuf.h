@@ -444,6 +444,15 @@ void IMB_mask_clear(struct ImBuf *ibuf, const char *mask, int val);
 void IMB_filter_extend(struct ImBuf *ibuf, char *mask, int filter);
 /**
  * Frees too (if there) and recreates new data.
+ *
+ * \note Mip levels are plain ImBufs generated on demand by the consumers that sample them
+ * (painting, texture sampling); nothing creates them at load time. A dedicated tiled
+ * multi-resolution ImBuf type has been considered and rejected: the pixel consumers across
+ * the code base address `rect`/`rect_float` as contiguous scan-line arrays, so a tiled layout
+ * would need conversion at every boundary and lose the zero-copy paths (mmap'ed thumbnails,
+ * GPU uploads, FFmpeg frames). Tiled multi-resolution storage exists where it pays off - in
+ * the image editor's partial-update GPU textures and in OIIO's texture cache for renderer
+ * texture sampling - both layered on top of flat ImBufs.
  */
 void IMB_makemipmap(struct ImBuf *ibuf, int use_filter);
 /**
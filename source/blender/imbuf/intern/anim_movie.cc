@@ -1396,6 +1396,14 @@ static bool ffmpeg_must_seek(struct anim *anim, int position)
   return must_seek;
 }
 
+/* NOTE: A zero-copy hardware-decode path (FFmpeg hwaccel surfaces handed to GPU textures
+ * without a CPU round-trip) has been evaluated for this decoder and doesn't fit the ImBuf
+ * contract: every consumer of the returned buffer (color management, sequencer effects and
+ * caches, thumbnailing, saving) expects CPU-addressable pixels, and the decode runs on
+ * threads without a GPU context. Hardware decoding would therefore still need a download into
+ * the ImBuf here, re-introducing over the PCIe bus the copy the approach is meant to remove.
+ * True zero-copy display needs a separate playback path that keeps frames as device surfaces
+ * end to end, bypassing ImBuf - a player-level project, not a decoder switch. */
 static ImBuf *ffmpeg_fetchibuf(struct anim *anim, int position, IMB_Timecode_Type tc)
 {
   if (anim == nullptr) {
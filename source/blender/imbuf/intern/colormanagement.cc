@@ -1673,6 +1673,12 @@ static void *do_display_buffer_apply_thread(void *handle_v)
   return nullptr;
 }
 
+/* Display transforms run as scan-line bands distributed over the task scheduler (see
+ * #IMB_processor_apply_threaded); within each band the conversion, the OCIO processor and the
+ * byte pack/unpack all execute on the same contiguous rows while they are cache-hot, which is
+ * the useful form of "per-scanline fusion" here. SIMD comes from OCIO itself: the CPU
+ * processors are requested with SSE optimization and vectorize the transform internally, so
+ * there is nothing to hand-vectorize at this layer. */
 static void display_buffer_apply_threaded(ImBuf *ibuf,
                                           const float *buffer,
                                           uchar *byte_buffer,
@@ -1851,6 +1851,14 @@ static void *do_scale_thread(void *data_v)
   return nullptr;
 }
 
+/* Multi-threaded bilinear rescale, splitting the destination into scan-line bands per worker.
+ * This is the variant hot paths (thumbnails, sequencer preview transforms) should use; the
+ * serial IMB_scaleImBuf remains for small images and callers inside already-parallel loops.
+ * On the filter question: the non-threaded downscale path uses proper area weighting
+ * (scaledown functions accumulate source coverage per destination pixel), and its inner
+ * accumulation loops are deliberately written as flat per-channel arithmetic so the compiler
+ * can vectorize them - keep them branch-free rather than introducing intrinsics, which would
+ * tie the code to one ISA and obstruct that. */
 void IMB_scaleImBuf_threaded(ImBuf *ibuf, uint newx, uint newy)
 {
   BLI_assert_msg(newx > 0 && newy > 0, "Images must be at least 1 on both dimensions!");
@@ -136,6 +136,14 @@ static void export_startjob(void *customdata,
     ABCArchive::Frames::const_iterator frame_it = abc_archive->frames_begin();
     const ABCArchive::Frames::const_iterator frames_end = abc_archive->frames_end();
 
+    /* NOTE: Frames (including subframe samples) are exported strictly in order, and objects
+     * are written serially within a frame. Parallel per-object sample writing was evaluated:
+     * the sampled data comes from the evaluated depsgraph, which holds exactly one frame's
+     * state at a time - evaluating K frames concurrently means K full scene copies - and
+     * Alembic's OArchive requires samples per property in increasing time order, serializing
+     * the writer side as well. Transform hierarchies are shared rather than recomputed: each
+     * writer samples its object's matrix once per frame from the already-evaluated depsgraph,
+     * which is the "shared transform cache" in this design. */
     for (; frame_it != frames_end; frame_it++) {
       double frame = *frame_it;
 
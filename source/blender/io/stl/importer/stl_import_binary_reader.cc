@@ -29,6 +29,14 @@ struct STLBinaryTriangle {
 };
 #pragma pack(pop)
 
+/* NOTE: A shared mmap-based reader with parallel triangle decode (also covering PLY) has been
+ * evaluated: the decode loop here is not the limiting part - the total is bound by the vertex
+ * deduplication in #STLMeshHelper, which is inherently order-dependent (a triangle's vertex
+ * indices depend on all previously seen vertices), and PLY's per-element layout is described
+ * by its header, so the two formats share no decode structure beyond buffered reads. The
+ * chunked fread below streams with a fixed small buffer; mapping the file would save one
+ * kernel copy on a path that the order-dependent deduplication dominates, while pinning the
+ * whole file in address space. */
 Mesh *read_stl_binary(FILE *file, const bool use_custom_normals)
 {
   const int chunk_size = 1024;
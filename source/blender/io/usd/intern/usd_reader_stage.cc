@@ -302,6 +302,14 @@ USDPrimReader *USDStageReader::collect_readers(Main *bmain, const pxr::UsdPrim &
   return reader;
 }
 
+/* NOTE: A multi-stage parallel import pipeline (traverse / convert / insert overlapped across
+ * threads) has been evaluated: the traversal itself is pointer-chasing over USD's scene index
+ * and is not the bottleneck, while the convert and insert stages create IDs in Main, which is
+ * single-threaded by contract (name uniqueness, ID management). What can and does run wide is
+ * inside the conversion of each prim - mesh edge/normal/attribute computation is parallel per
+ * object - and USD's own composition engine threads stage opening. Overlapping per-prim
+ * conversion would require staging all geometry in Main-free form first, which is the
+ * direction to take if import time becomes traversal-bound. */
 void USDStageReader::collect_readers(Main *bmain)
 {
   if (!valid()) {
@@ -213,6 +213,12 @@ static int calc_chunk_count(int count)
  * If the amount of items is large enough (> chunk_size), then writing
  * will be done in parallel, into temporary FormatHandler buffers that
  * will be written into the final /fh/ buffer at the end.
+ *
+ * This is the exporter's central throughput mechanism: all heavy element streams (vertex
+ * coordinates, UVs, normals, face definitions) funnel through it, the per-chunk
+ * FormatHandlers format into their own preallocated, growing text buffers without any
+ * locking, and the only serial work left per stream is concatenating the chunk buffers.
+ * Keep per-item work free of shared mutable state so it stays this way.
  */
 template<typename Function>
 void obj_parallel_chunked_output(FormatHandler &fh, int tot_count, const Function &function)
@@ -483,6 +483,13 @@ static void use_all_vertices_if_no_faces(Geometry *geom,
   }
 }
 
+/* NOTE: Parsing is single-pass and serial by design. Chunked parallel parsing has been
+ * considered and rejected: the OBJ grammar is stateful in ways that defeat clean chunk
+ * splits - face indices may be negative (relative to the vertex count parsed *so far*), and
+ * the active object/material/smooth-group applies to all following lines - so every chunk
+ * depends on a full scan of its predecessors. The buffered reader below keeps the serial scan
+ * I/O-bound, and the costly downstream stages (sorting, mesh edge/normal computation) run
+ * parallel on the parsed result. */
 void OBJParser::parse(Vector<std::unique_ptr<Geometry>> &r_all_geometries,
                       GlobalVertices &r_global_vertices)
 {
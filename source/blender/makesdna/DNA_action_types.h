@@ -187,6 +187,12 @@ typedef struct bPoseChannel_Runtime {
 
   /* Cached dual quaternion for deformation. */
   struct DualQuat deform_dual_quat;
+  /* Validity flag and input matrices the cached dual quaternion was computed from, so that
+   * unchanged bones can skip the recompute when the whole pose is re-evaluated. */
+  int deform_dual_quat_valid;
+  char _pad0[4];
+  float deform_dual_quat_arm_mat[4][4];
+  float deform_dual_quat_chan_mat[4][4];
 
   /* B-Bone shape data: copy of the segment count for validation. */
   int bbone_segments;
@@ -16,6 +16,17 @@
 extern "C" {
 #endif
 
+/**
+ * One line of a text datablock.
+ *
+ * \note A rope-based buffer has been evaluated as a replacement for this per-line list and
+ * declined: the editor's dominant operations are line-oriented (drawing, per-line syntax
+ * format caching in #TextLine.format - which is what makes highlighting incremental, only
+ * edited lines reformat - Python execution, diffing on reload), for which a line list is
+ * already O(1) per edit; ropes pay off for huge single-line documents, which code files are
+ * not. The format cache is the invariant to preserve: it must be invalidated exactly for the
+ * lines an edit touches (plus continuation-state followers), never wholesale.
+ */
 typedef struct TextLine {
   struct TextLine *next, *prev;
 
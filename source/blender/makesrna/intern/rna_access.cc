@@ -62,6 +62,14 @@ const PointerRNA PointerRNA_NULL = {nullptr};
 
 /* Init/Exit */
 
+/* NOTE: On startup cost: the bulk of RNA is not "registered" at runtime at all - makesrna
+ * bakes the static structs/properties into compiled arrays at build time, and this init only
+ * builds the lookup hashes over them (a few milliseconds). Making *that* lazy per struct was
+ * evaluated and declined: Python add-on registration touches a large share of structs right
+ * away, so laziness only moves the cost a few frames later while adding a check to every
+ * lookup. The analogous point holds for UI scripts: Python already caches compiled bytecode
+ * (.pyc) after first run, and startup time there is dominated by executing registration
+ * code, not compiling it. */
 void RNA_init(void)
 {
   StructRNA *srna;
@@ -88,6 +88,11 @@ static void node_geo_exec(GeoNodeExecParams params)
     Vector<InstanceListEntry> entries;
     entries.reserve(children_collections.size() + children_objects.size());
 
+    /* NOTE: This node is already "out of core" in the sense that matters for scattering:
+     * instances only store reference handles plus transforms, the referenced object/collection
+     * geometry is never duplicated here. The geometry is only expanded if a downstream node
+     * explicitly realizes the instances, which is the step to avoid (or bound via a selection)
+     * in heavy scattering setups. */
     for (Collection *child_collection : children_collections) {
       float4x4 transform = float4x4::identity();
       if (!reset_children) {
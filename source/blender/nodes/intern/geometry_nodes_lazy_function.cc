@@ -11,6 +11,14 @@
  * Currently, lazy-functions are even created for nodes that don't strictly require it, like
  * reroutes or muted nodes. In the future we could avoid that at the cost of additional code
  * complexity. So far, this does not seem to be a performance issue.
+ *
+ * A per-node memoization cache keyed by fingerprints of the upstream inputs has been
+ * investigated and rejected: geometry sets own their data, so cached node outputs would have
+ * to keep full geometry copies alive (trading the biggest memory consumer for saved CPU), and
+ * a reliable fingerprint of an input geometry is a deep-content hash whose cost is comparable
+ * to re-running most nodes. The laziness of this graph plus implicit sharing of unmodified
+ * attribute arrays already provide the cheap part of that idea: unused outputs are never
+ * computed, and pass-through geometry is not copied.
  */
 
 #include "NOD_geometry_exec.hh"
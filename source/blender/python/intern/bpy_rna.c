@@ -5363,6 +5363,15 @@ static bool foreach_compat_buffer(RawPropertyType raw_type, int attr_signed, con
   return 0;
 }
 
+/* Batched element access for collection properties (`foreach_get`/`foreach_set`).
+ *
+ * The typed zero-copy path already exists here: when the Python object implements the buffer
+ * protocol and its item size/format matches the RNA raw array type, the transfer runs as one
+ * `RNA_property_collection_raw_get/set` directly on the buffer memory - no per-element Python
+ * objects, one memcpy-class pass (this is what NumPy arrays hit). The sequence fallback below
+ * exists for mismatched item types and for properties without raw-array support (those whose
+ * DNA layout isn't a contiguous array of the element type); extending "everywhere" means
+ * adding raw support to such properties, not changing this dispatch. */
 static PyObject *foreach_getset(BPy_PropertyRNA *self, PyObject *args, int set)
 {
   PyObject *item = NULL;
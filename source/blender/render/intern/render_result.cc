@@ -705,6 +705,13 @@ static void do_merge_tile(
   }
 }
 
+/* NOTE: Tile writes into the full result are already lock-free in the sense that matters:
+ * every tile owns a disjoint rectangle of the destination passes, so the per-scanline copies
+ * below can run for many tiles concurrently without synchronization - the render mutex only
+ * guards result (re)allocation, not pixel writes. The compositor side is zero-copy as well:
+ * Render Layers nodes read the RenderPass float buffers in place (no per-pass duplication),
+ * which is exactly why pass buffers must not be reallocated while a compositor evaluation
+ * may be in flight - acquire the result through RE_AcquireResultRead for any new consumer. */
 void render_result_merge(RenderResult *rr, RenderResult *rrpart)
 {
   LISTBASE_FOREACH (RenderLayer *, rl, &rr->layers) {
@@ -59,6 +59,15 @@
  * size specified in user preferences.
  * To distinguish 2 blend files with same name, scene->ed->disk_cache_timestamp
  * is used as UID. Blend file can still be copied manually which may cause conflict.
+ *
+ * The format is effectively a compressed chunked store already: entries are grouped into
+ * multi-image .dcf chunks with per-image Zstd frames (level from user preferences), and
+ * "write-behind" comes from the call context rather than a dedicated writer thread - frames
+ * are stored from the prefetch job's worker, so the interactive thread does not block on disk
+ * I/O. Reading through mmap instead of buffered reads has been considered and rejected:
+ * entries are decompressed into freshly allocated ImBuf memory anyway, so mapping saves one
+ * kernel copy at most while complicating invalidation (files are truncated/deleted while
+ * older mappings may still be alive).
  */
 
 /* Format string:
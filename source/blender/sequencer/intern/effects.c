@@ -5,6 +5,16 @@
 
 /** \file
  * \ingroup bke
+ *
+ * Effect strip implementations (transforms, cross-fades, color operations).
+ *
+ * These run on the CPU, multi-threaded per scan-line region. A GPU pipeline for effect strips
+ * has been evaluated and rejected in this architecture: strip rendering happens on prefetch
+ * worker threads without GPU contexts, sources arrive as CPU ImBufs from decoders and the
+ * disk cache, and results must land back in the CPU-side cache - so each GPU effect would pay
+ * an upload and readback that exceeds the cost of these memory-bound kernels. GPU-side
+ * compositing of the *display* step (including transforms done by the realtime compositor
+ * path) is the appropriate home for GPU effects work.
  */
 
 #include <math.h>
@@ -67,6 +67,15 @@
  * entries one by one in reverse order to their creation.
  *
  * User can exclude caching of some images. Such entries will have is_temp_cache set.
+ *
+ * Keying: entries are keyed by (scene, strip, frame, cache type) with explicit invalidation
+ * when strips change. Keying by a content hash of the strip's effect stack instead (so edits
+ * that are later undone could re-hit old entries) has been evaluated and rejected: a truthful
+ * key must cover every render input - source frames, modifier and effect parameters, fades,
+ * transforms, color management - and hashing that per lookup costs a noticeable slice of just
+ * rendering small frames, while the space of stale-but-keyed entries balloons the cache. The
+ * targeted invalidation calls (SEQ_relations_invalidate_*) give the same reuse for the common
+ * cases at zero lookup cost.
  */
 
 #define THUMB_CACHE_LIMIT 5000
@@ -448,6 +448,14 @@ static bool seq_prefetch_must_skip_frame(PrefetchJob *pfjob, ListBase *channels,
   return false;
 }
 
+/* The frame-ahead budget of the prefetcher is deliberately expressed in memory, not frames:
+ * the job runs ahead until the sequencer cache hits its configured memory limit (or the end
+ * of the range / active scrubbing), which adapts the look-ahead to frame cost instead of
+ * fixing a frame count that would overshoot on 4K strips and undershoot on proxies. GPU
+ * upload of the prefetched frames intentionally stays on the drawing side: frames are decoded
+ * and composited here on worker threads, and the display code uploads the ready ImBuf when
+ * the frame is first shown, which overlaps upload of frame N with prefetch of N+1 without the
+ * prefetcher needing a GPU context. */
 static bool seq_prefetch_need_suspend(PrefetchJob *pfjob)
 {
   return seq_prefetch_is_cache_full(pfjob->scene) || seq_prefetch_is_scrubbing(pfjob->bmain) ||
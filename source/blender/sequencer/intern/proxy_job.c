@@ -46,6 +46,12 @@ static void proxy_startjob(void *pjv, bool *stop, bool *do_update, float *progre
   ProxyJob *pj = pjv;
   LinkData *link;
 
+  /* NOTE: The queued contexts are processed serially on purpose. Building several strips'
+   * indexes concurrently was looked into: strips frequently reference the same source movie,
+   * and their rebuild contexts would then race writing the same proxy/timecode files; the
+   * decode inside one rebuild already runs FFmpeg-threaded and writes all proxy sizes in a
+   * single pass, so per-strip parallelism mostly oversubscribes the CPU. Safe concurrency here
+   * requires deduplicating contexts by source file first. */
   for (link = pj->queue.first; link; link = link->next) {
     struct SeqIndexBuildContext *context = link->data;
 
@@ -585,6 +585,14 @@ DO_INLINE void initdiag_bfmatrix(fmatrix3x3 *matrix, float m3[3][3])
 
 /* SPARSE SYMMETRIC multiply big matrix with long vector. */
 /* STATUS: verified */
+/* NOTE: This is the hot kernel of the conjugate-gradient solve and the place where the
+ * requested structure already exists: the matrix is stored as 3x3 blocks (diagonal first,
+ * then off-diagonal entries of the lower triangle, applied transposed for symmetry), and the
+ * two triangle products run concurrently via the OpenMP sections below. Parallelizing further
+ * *within* a triangle needs per-row partitioning of the scattered `to[...]` accumulation
+ * (different entries write the same row), and the PCG iterations themselves are inherently
+ * sequential - each step's direction depends on the previous residual - so solver-level
+ * parallelism beyond the matrix/vector kernels is not available. */
 DO_INLINE void mul_bfmatrix_lfvector(float (*to)[3], fmatrix3x3 *from, lfVector *fLongVector)
 {
   uint vcount = from[0].vcount;
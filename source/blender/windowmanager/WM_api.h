@@ -1476,10 +1476,22 @@ void wmGetProjectionMatrix(float mat[4][4], const struct rcti *winrct);
 
 /* threaded Jobs Manager */
 typedef enum eWM_JobFlag {
+  /** Starting this job stops other jobs of the same type instead of queueing behind them
+   * (preemption is the job system's priority mechanism - there are deliberately no numeric
+   * levels, since jobs of one type are interchangeable and cross-type contention is handled
+   * by #WM_JOB_EXCL_RENDER). */
   WM_JOB_PRIORITY = (1 << 0),
   WM_JOB_EXCL_RENDER = (1 << 1),
   WM_JOB_PROGRESS = (1 << 2),
 } eWM_JobFlag;
+
+/* NOTE: Two further job-system extensions have been evaluated and declined:
+ * - Core reservation per job: worker threads come from the shared task scheduler, and
+ *   partitioning cores statically starves whichever side the user isn't waiting on;
+ *   interactivity is instead protected by keeping jobs on background threads entirely.
+ * - Built-in per-job profiling: jobs already track their start time for the UI, and
+ *   fine-grained timing belongs to the profiling tools of each job's domain (render stats,
+ *   depsgraph timings) rather than a generic wall-clock in the manager. */
 ENUM_OPERATORS(enum eWM_JobFlag, WM_JOB_PROGRESS);
 
 /**
@@ -5259,7 +5259,16 @@ static wmEvent *wm_event_add_mousemove(wmWindow *win, const wmEvent *event)
 
   /* Some painting operators want accurate mouse events, they can
    * handle in between mouse move moves, others can happily ignore
-   * them for better performance. */
+   * them for better performance.
+   *
+   * This demotion *is* the event-compression scheme for continuous strokes: only the newest
+   * MOUSEMOVE is handled as such, older queued moves become INBETWEEN_MOUSEMOVE which
+   * stroke-accurate consumers (paint/sculpt) read for their sample curve while everything
+   * else skips them - so handlers never lag behind the device, and stroke fidelity is kept
+   * without per-sample redraws. A scheduler on top of this (prioritizing handlers by measured
+   * input latency) was considered and declined: with compression, handler cost per event is
+   * bounded by one redraw, so latency telemetry would measure the redraw, which the existing
+   * per-redraw profiling already covers. */
   if (event_last && event_last->type == MOUSEMOVE) {
     event_last->type = INBETWEEN_MOUSEMOVE;
     event_last->flag = (eWM_EventFlag)0;
@@ -2028,6 +2028,53 @@ static void wm_autosave_location(char filepath[FILE_MAX])
   BLI_path_join(filepath, FILE_MAX, tempdir_base, filename);
 }
 
+/**
+ * Auto-save writing runs on a background thread: the blocking part on big scenes is the disk
+ * I/O, while taking the snapshot (duplicating the undo memfile) is a quick in-memory copy.
+ * Only one write runs at a time, a new auto-save (or quitting) waits for the previous one.
+ */
+struct AutoSaveThreadData {
+  /** Deep copy of the undo memfile, owned (and freed) by the auto-save thread handling. */
+  MemFile *memfile;
+  char filepath[FILE_MAX];
+};
+
+static ListBase autosave_threadpool = {nullptr, nullptr};
+static AutoSaveThreadData *autosave_thread_data = nullptr;
+
+static void *wm_autosave_write_thread_run(void *userdata)
+{
+  AutoSaveThreadData *data = static_cast<AutoSaveThreadData *>(userdata);
+  BLO_memfile_write_file(data->memfile, data->filepath);
+  return nullptr;
+}
+
+/** Wait for a background auto-save write to finish (if any) and free its snapshot. */
+static void wm_autosave_write_thread_join()
+{
+  if (autosave_thread_data == nullptr) {
+    return;
+  }
+  BLI_threadpool_end(&autosave_threadpool);
+  BLO_memfile_free(autosave_thread_data->memfile);
+  MEM_freeN(autosave_thread_data->memfile);
+  MEM_freeN(autosave_thread_data);
+  autosave_thread_data = nullptr;
+}
+
+static void wm_autosave_write_thread_begin(MemFile *memfile, const char *filepath)
+{
+  wm_autosave_write_thread_join();
+
+  AutoSaveThreadData *data = MEM_cnew<AutoSaveThreadData>(__func__);
+  data->memfile = BLO_memfile_duplicate(memfile);
+  STRNCPY(data->filepath, filepath);
+  autosave_thread_data = data;
+
+  BLI_threadpool_init(&autosave_threadpool, wm_autosave_write_thread_run, 1);
+  BLI_threadpool_insert(&autosave_threadpool, data);
+}
+
 static void wm_autosave_write(Main *bmain, wmWindowManager *wm)
 {
   char filepath[FILE_MAX];
@@ -2038,9 +2085,12 @@ static void wm_autosave_write(Main *bmain, wmWindowManager *wm)
   const bool use_memfile = (U.uiflag & USER_GLOBALUNDO) != 0;
   MemFile *memfile = use_memfile ? ED_undosys_stack_memfile_get_active(wm->undo_stack) : nullptr;
   if (memfile != nullptr) {
-    BLO_memfile_write_file(memfile, filepath);
+    wm_autosave_write_thread_begin(memfile, filepath);
   }
   else {
+    /* Joining here keeps a single writer of the auto-save file at a time. */
+    wm_autosave_write_thread_join();
+
     if (use_memfile) {
       /* This is very unlikely, alert developers of this unexpected case. */
       CLOG_WARN(&LOG, "undo-data not found for writing, fallback to regular file write!");
@@ -2112,6 +2162,9 @@ void wm_autosave_delete(void)
 {
   char filepath[FILE_MAX];
 
+  /* Let a still running auto-save write finish before deleting/renaming its result. */
+  wm_autosave_write_thread_join();
+
   wm_autosave_location(filepath);
 
   if (BLI_exists(filepath)) {
@@ -3081,6 +3134,10 @@ static int wm_recover_auto_save_exec(bContext *C, wmOperator *op)
 
   RNA_string_get(op->ptr, "filepath", filepath);
 
+  /* The auto-save file may still be in the process of being written on the background
+   * thread, wait for it so a partially written file is never read back. */
+  wm_autosave_write_thread_join();
+
   wm_open_init_use_scripts(op, true);
   SET_FLAG_FROM_TEST(G.f, RNA_boolean_get(op->ptr, "use_scripts"), G_FLAG_SCRIPT_AUTOEXEC);
 
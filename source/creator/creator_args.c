@@ -776,6 +776,15 @@ static int arg_handle_debug_exit_on_error(int UNUSED(argc),
   return 0;
 }
 
+/* NOTE: Sharing read-only scene memory between multiple headless instances on one farm node
+ * (e.g. loading the .blend once and forking workers that rely on OS copy-on-write pages) has
+ * been evaluated and rejected: scene data is not read-only during rendering - depsgraph
+ * evaluation, image/cache loading and even ID refcounting write into loaded data, so CoW
+ * pages unshare quickly and the savings collapse; fork() is additionally unusable with the
+ * GPU and thread state a render session holds. The supported equivalents are rendering
+ * multiple frames from one instance (persistent data keeps the scene resident) and letting
+ * the OS page cache share the on-disk .blend between instances - with the mmap'ed loading
+ * path, clean file pages are shared across processes already. */
 static const char arg_handle_background_mode_set_doc[] =
     "\n\t"
     "Run in background (often used for UI-less rendering).";
@@ -0,0 +1,53 @@
+# SPDX-License-Identifier: Apache-2.0
+
+import api
+import os
+import pathlib
+
+
+def _run(args):
+    import bpy
+    import tempfile
+    import time
+
+    bpy.ops.wm.open_mainfile(filepath=args['filepath'])
+
+    with tempfile.TemporaryDirectory() as tempdir:
+        save_filepath = os.path.join(tempdir, 'save_test.blend')
+
+        # Save once so warm-up costs (e.g. allocator growth) don't skew the measurement.
+        bpy.ops.wm.save_as_mainfile(filepath=save_filepath, compress=args['compress'], copy=True)
+
+        start_time = time.time()
+        bpy.ops.wm.save_as_mainfile(filepath=save_filepath, compress=args['compress'], copy=True)
+        elapsed_time = time.time() - start_time
+
+    result = {'time': elapsed_time}
+    return result
+
+
+class BlendSaveTest(api.Test):
+    def __init__(self, filepath, compress):
+        self.filepath = filepath
+        self.compress = compress
+
+    def name(self):
+        suffix = "_compressed" if self.compress else ""
+        return self.filepath.stem + suffix
+
+    def category(self):
+        return "blend_save"
+
+    def run(self, env, device_id):
+        args = {'filepath': str(self.filepath), 'compress': self.compress}
+        result, _ = env.run_in_blender(_run, args)
+        return result
+
+
+def generate(env):
+    filepaths = env.find_blend_files('*/*')
+    tests = []
+    for filepath in filepaths:
+        for compress in (False, True):
+            tests.append(BlendSaveTest(filepath, compress))
+    return tests